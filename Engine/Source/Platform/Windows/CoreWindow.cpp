@@ -58,14 +58,14 @@ CoreWindow::CoreWindow() : Super()
 	wcex.hInstance = GetModuleHandleW(nullptr);
 	if (RegisterClassExW(&wcex) == 0)
 	{
-		LogSystem::Log(LogWindows, Fatal, L"Could not register window class with error code: {}. Abort.", ::GetLastError());
+		LogSystem::Log<Fatal>(LogWindows, L"Could not register window class with error code: {}. Abort.", ::GetLastError());
 		return;
 	}
 
 	HWND hWnd = CreateWindowExW(0, wcex.lpszClassName, L"GameApp", WS_OVERLAPPEDWINDOW, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, CW_USEDEFAULT, nullptr, nullptr, wcex.hInstance, this);
 	if (hWnd == nullptr)
 	{
-		LogSystem::Log(LogWindows, Fatal, L"Could not create core window with error code: {}. Abort.", ::GetLastError());
+		LogSystem::Log<Fatal>(LogWindows, L"Could not create core window with error code: {}. Abort.", ::GetLastError());
 		return;
 	}
 
@@ -5,10 +5,15 @@ export module SC.Runtime.Core;
 export import :SupportsObject;
 export import :PrimitiveTypes;
 export import :Object;
+export import :ObjectArena;
+export import :PendingKillQueue;
+export import :ObjectClass;
 
 // Utilities
 export import :StringUtils;
 export import :UniqueType;
+export import :HandleTable;
+export import :ScopeGuard;
 export import :DateTime;
 
 // Numerics
@@ -38,6 +43,9 @@ export import :MathEx;
 export import :LogSystem;
 export import :LogVerbosity;
 export import :LogCategory;
+export import :AsyncLogWriter;
+export import :BinaryLogWriter;
+export import :BinaryLogDecoder;
 
 // LogCategory
 export import :LogCore;
@@ -52,4 +60,5 @@ export import :DirectoryReference;
 export import :FileReference;
 
 // Threading
-export import :EventHandle;
\ No newline at end of file
+export import :EventHandle;
+export import :JobSystem;
\ No newline at end of file
@@ -20,28 +20,163 @@ export
 
 	/// <summary>
 	/// Represents a multicast delegate that is, a delegate that can have more than one element in its invocation list.
+	/// Bindings are stored contiguously and small callables are stored inline, so invoking makes no allocation.
+	/// Binding or removing function while invoking is safe; the invocation list is compacted after outermost invoke returns.
 	/// </summary>
 	/// <typeparam name="...TArgs"> The type of function arguments. </typeparam>
 	template<class... TArgs>
 	class MulticastDelegate<void(TArgs...)>
 	{
-		map<int64, function<void(TArgs...)>> _functions;
-		atomic<int64> _id = 0;
+		static constexpr size_t InlineStorageSize = 48;
+		static constexpr int64 RemovedId = -1;
+
+		enum class EStorageOp
+		{
+			Move,
+			Destroy
+		};
+
+		using InvokerType = void(*)(void* storage, TArgs... args);
+		using ManagerType = void(*)(EStorageOp op, void* storage, void* source);
+
+		template<class F>
+		static constexpr bool IsInlineStorable = sizeof(F) <= InlineStorageSize && alignof(F) <= alignof(max_align_t) && is_nothrow_move_constructible_v<F>;
+
+		class Binding
+		{
+		public:
+			int64 Id = RemovedId;
+			InvokerType Invoker = nullptr;
+			ManagerType Manager = nullptr;
+			alignas(max_align_t) uint8 Storage[InlineStorageSize];
+
+		public:
+			template<class F>
+			Binding(int64 id, F&& func) : Id(id)
+			{
+				using Callable = decay_t<F>;
+
+				if constexpr (IsInlineStorable<Callable>)
+				{
+					new(Storage) Callable(forward<F>(func));
+					Invoker = [](void* storage, TArgs... args)
+					{
+						(*launder(reinterpret_cast<Callable*>(storage)))(args...);
+					};
+					Manager = [](EStorageOp op, void* storage, void* source)
+					{
+						if (op == EStorageOp::Move)
+						{
+							auto* from = launder(reinterpret_cast<Callable*>(source));
+							new(storage) Callable(move(*from));
+							from->~Callable();
+						}
+						else
+						{
+							launder(reinterpret_cast<Callable*>(storage))->~Callable();
+						}
+					};
+				}
+				else
+				{
+					// Large callable is allocated when binding, not when invoking.
+					*reinterpret_cast<Callable**>(Storage) = new Callable(forward<F>(func));
+					Invoker = [](void* storage, TArgs... args)
+					{
+						(**reinterpret_cast<Callable**>(storage))(args...);
+					};
+					Manager = [](EStorageOp op, void* storage, void* source)
+					{
+						if (op == EStorageOp::Move)
+						{
+							*reinterpret_cast<Callable**>(storage) = *reinterpret_cast<Callable**>(source);
+						}
+						else
+						{
+							delete *reinterpret_cast<Callable**>(storage);
+						}
+					};
+				}
+			}
+
+			Binding(Binding&& rhs) noexcept
+				: Id(rhs.Id)
+				, Invoker(rhs.Invoker)
+				, Manager(rhs.Manager)
+			{
+				if (Manager != nullptr)
+				{
+					Manager(EStorageOp::Move, Storage, rhs.Storage);
+					rhs.Manager = nullptr;
+				}
+			}
+
+			~Binding() noexcept
+			{
+				Reset();
+			}
+
+			Binding& operator =(Binding&& rhs) noexcept
+			{
+				if (this != &rhs)
+				{
+					Reset();
+					Id = rhs.Id;
+					Invoker = rhs.Invoker;
+					Manager = rhs.Manager;
+					if (Manager != nullptr)
+					{
+						Manager(EStorageOp::Move, Storage, rhs.Storage);
+						rhs.Manager = nullptr;
+					}
+				}
+				return *this;
+			}
+
+		private:
+			void Reset()
+			{
+				if (Manager != nullptr)
+				{
+					Manager(EStorageOp::Destroy, Storage, nullptr);
+					Manager = nullptr;
+				}
+			}
+		};
+
+		vector<Binding> _bindings;
+		vector<Binding> _pendingBindings;
+		int64 _id = 0;
+		int32 _invokeDepth = 0;
+		bool _bPendingCompact = false;
 
 	public:
+		MulticastDelegate()
+		{
+		}
+
+		MulticastDelegate(const MulticastDelegate&) = delete;
+
 		~MulticastDelegate() noexcept
 		{
 		}
 
 		/// <summary>
-		/// Invoke all functions.
+		/// Invoke all functions. Functions that bound while invoking are called from next invoke.
 		/// </summary>
 		/// <param name="...args"> The function arguments. </param>
-		void Invoke(TArgs&&... args)
+		void Invoke(TArgs... args)
 		{
-			for (auto it : _functions)
+			InvokeScope scope(this);
+
+			// Invocation list is not reallocated while invoking since new bindings are pending.
+			for (size_t i = 0; i < _bindings.size(); ++i)
 			{
-				it.second(forward<TArgs>(args)...);
+				Binding& binding = _bindings[i];
+				if (binding.Id != RemovedId)
+				{
+					binding.Invoker(binding.Storage, args...);
+				}
 			}
 		}
 
@@ -50,11 +185,24 @@ export
 		/// </summary>
 		/// <param name="func"> The raw function. </param>
 		/// <returns> Return valid function id if succeeded to bind, otherwise return -1. </returns>
-		int64 AddRaw(function<void(TArgs...)> func)
+		template<class F> requires invocable<F&, TArgs...>
+		int64 AddRaw(F&& func)
 		{
 			int64 id = _id++;
-			auto pair = _functions.emplace(id, move(func));
-			return pair.second ? id : -1;
+			(_invokeDepth > 0 ? _pendingBindings : _bindings).emplace_back(id, forward<F>(func));
+			return id;
+		}
+
+		/// <summary>
+		/// Add member function to multicast delegate. The member function is called directly without std::function.
+		/// </summary>
+		/// <param name="object"> The object that called with member function. </param>
+		/// <param name="method"> The member function. </param>
+		/// <returns> Return valid function id if succeeded to bind, otherwise return -1. </returns>
+		template<class T>
+		int64 AddMember(T* object, void (T::*method)(TArgs...))
+		{
+			return AddRaw([object, method](TArgs... args) { (object->*method)(args...); });
 		}
 
 		/// <summary>
@@ -62,12 +210,89 @@ export
 		/// </summary>
 		void RemoveRaw(int64 id)
 		{
-			_functions.erase(id);
+			if (id == RemovedId)
+			{
+				return;
+			}
+
+			if (_invokeDepth > 0)
+			{
+				// Function may be running now. Mark removed and compact after invoke.
+				for (auto& binding : _bindings)
+				{
+					if (binding.Id == id)
+					{
+						binding.Id = RemovedId;
+						_bPendingCompact = true;
+						return;
+					}
+				}
+
+				erase_if(_pendingBindings, [id](const Binding& binding) { return binding.Id == id; });
+			}
+			else
+			{
+				erase_if(_bindings, [id](const Binding& binding) { return binding.Id == id; });
+			}
+		}
+
+		/// <summary>
+		/// Get count of binded functions.
+		/// </summary>
+		size_t GetCount() const
+		{
+			size_t count = _pendingBindings.size();
+			for (auto& binding : _bindings)
+			{
+				if (binding.Id != RemovedId)
+				{
+					++count;
+				}
+			}
+			return count;
+		}
+
+		template<class F> requires invocable<F&, TArgs...>
+		int64 operator +=(F&& func)
+		{
+			return AddRaw(forward<F>(func));
 		}
 
-		int64 operator +=(function<void(TArgs...)> func)
+	private:
+		struct InvokeScope
+		{
+			MulticastDelegate* const Delegate;
+
+			InvokeScope(MulticastDelegate* d) : Delegate(d)
+			{
+				++Delegate->_invokeDepth;
+			}
+
+			~InvokeScope() noexcept
+			{
+				if (--Delegate->_invokeDepth == 0)
+				{
+					Delegate->Compact();
+				}
+			}
+		};
+
+		void Compact()
 		{
-			return AddRaw(func);
+			if (_bPendingCompact)
+			{
+				erase_if(_bindings, [](const Binding& binding) { return binding.Id == RemovedId; });
+				_bPendingCompact = false;
+			}
+
+			if (!_pendingBindings.empty())
+			{
+				for (auto& binding : _pendingBindings)
+				{
+					_bindings.emplace_back(move(binding));
+				}
+				_pendingBindings.clear();
+			}
 		}
 	};
 }
\ No newline at end of file
@@ -0,0 +1,166 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.Core.Internal;
+
+using namespace std;
+using namespace std::chrono;
+
+AsyncLogWriter::AsyncLogWriter(FileReference* file, size_t capacity, size_t flushThreshold, milliseconds flushInterval)
+	: _file(file)
+	, _flushThreshold(flushThreshold)
+	, _flushInterval(flushInterval)
+	, _cells(make_unique<Cell[]>(bit_ceil(max(capacity, (size_t)2))))
+	, _mask(bit_ceil(max(capacity, (size_t)2)) - 1)
+{
+	for (size_t i = 0; i <= _mask; ++i)
+	{
+		_cells[i].Sequence.store(i, memory_order_relaxed);
+	}
+
+	_writerThread = thread([this]() { Worker(); });
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+	{
+		unique_lock lock(_wakeLock);
+		_bRunning = false;
+	}
+
+	_wakeup.notify_one();
+	_writerThread.join();
+
+	_file->CloseSharedStream(this);
+}
+
+bool AsyncLogWriter::Push(wstring&& message)
+{
+	Cell* cell = nullptr;
+	size_t pos = _enqueuePos.load(memory_order_relaxed);
+
+	while (true)
+	{
+		cell = &_cells[pos & _mask];
+		size_t sequence = cell->Sequence.load(memory_order_acquire);
+		intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+		if (diff == 0)
+		{
+			if (_enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			// Ring buffer is full.
+			_numDropped.fetch_add(1, memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			pos = _enqueuePos.load(memory_order_relaxed);
+		}
+	}
+
+	cell->Message = move(message);
+	cell->Sequence.store(pos + 1, memory_order_release);
+
+	if (GetQueueDepth() >= _flushThreshold)
+	{
+		_wakeup.notify_one();
+	}
+
+	return true;
+}
+
+void AsyncLogWriter::Flush()
+{
+	unique_lock lock(_drainLock);
+
+	size_t count = 0;
+	wstring message;
+	while (Pop(message))
+	{
+		_batch += message;
+		++count;
+	}
+
+	if (count == 0)
+	{
+		return;
+	}
+
+	wfstream& stream = _file->OpenSharedStream(this, ios::app, true);
+	if (stream.is_open())
+	{
+		stream << _batch;
+		stream.flush();
+	}
+	OutputDebugStringW(_batch.c_str());
+
+	// Keep capacity for next batch.
+	_batch.clear();
+	_numWritten.fetch_add(count, memory_order_relaxed);
+}
+
+size_t AsyncLogWriter::GetQueueDepth() const
+{
+	size_t enqueuePos = _enqueuePos.load(memory_order_relaxed);
+	size_t dequeuePos = _dequeuePos.load(memory_order_relaxed);
+	return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+}
+
+bool AsyncLogWriter::Pop(wstring& message)
+{
+	Cell* cell = nullptr;
+	size_t pos = _dequeuePos.load(memory_order_relaxed);
+
+	while (true)
+	{
+		cell = &_cells[pos & _mask];
+		size_t sequence = cell->Sequence.load(memory_order_acquire);
+		intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+		if (diff == 0)
+		{
+			if (_dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			// Ring buffer is empty.
+			return false;
+		}
+		else
+		{
+			pos = _dequeuePos.load(memory_order_relaxed);
+		}
+	}
+
+	message = move(cell->Message);
+	cell->Sequence.store(pos + _mask + 1, memory_order_release);
+	return true;
+}
+
+void AsyncLogWriter::Worker()
+{
+	unique_lock lock(_wakeLock);
+	while (_bRunning)
+	{
+		_wakeup.wait_for(lock, _flushInterval, [this]() { return !_bRunning || GetQueueDepth() >= _flushThreshold; });
+
+		lock.unlock();
+		Flush();
+		lock.lock();
+	}
+
+	// Write remaining messages before exit.
+	lock.unlock();
+	Flush();
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:AsyncLogWriter;
+
+import std.core;
+import std.threading;
+import :Object;
+import :PrimitiveTypes;
+import :FileReference;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents background log writer. Producers push composed messages into lock-free ring buffer,
+/// and writer thread writes them in batch when queued messages exceed threshold or flush interval is elapsed.
+/// </summary>
+export class AsyncLogWriter : virtual public Object
+{
+public:
+	using Super = Object;
+
+	/// <summary>
+	/// The default capacity of ring buffer.
+	/// </summary>
+	static constexpr size_t DefaultCapacity = 4096;
+
+	/// <summary>
+	/// The default count of queued messages that wake up writer thread.
+	/// </summary>
+	static constexpr size_t DefaultFlushThreshold = 256;
+
+	/// <summary>
+	/// The default interval of flushing.
+	/// </summary>
+	static constexpr milliseconds DefaultFlushInterval = 100ms;
+
+private:
+	struct Cell
+	{
+		atomic<size_t> Sequence;
+		wstring Message;
+	};
+
+	FileReference* const _file = nullptr;
+	const size_t _flushThreshold;
+	const milliseconds _flushInterval;
+
+	unique_ptr<Cell[]> _cells;
+	const size_t _mask;
+	alignas(64) atomic<size_t> _enqueuePos = 0;
+	alignas(64) atomic<size_t> _dequeuePos = 0;
+
+	atomic<size_t> _numDropped = 0;
+	atomic<size_t> _numWritten = 0;
+
+	mutex _drainLock;
+	wstring _batch;
+
+	mutex _wakeLock;
+	condition_variable _wakeup;
+	bool _bRunning = true;
+	thread _writerThread;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="AsyncLogWriter"/> instance and start writer thread.
+	/// </summary>
+	/// <param name="file"> The log file. </param>
+	/// <param name="capacity"> The capacity of ring buffer. Rounded up to power of two. </param>
+	/// <param name="flushThreshold"> The count of queued messages that wake up writer thread. </param>
+	/// <param name="flushInterval"> The maximum interval of flushing. </param>
+	AsyncLogWriter(FileReference* file, size_t capacity = DefaultCapacity, size_t flushThreshold = DefaultFlushThreshold, milliseconds flushInterval = DefaultFlushInterval);
+	~AsyncLogWriter() override;
+
+	/// <summary>
+	/// Push composed message. Never blocks. Message is dropped if ring buffer is full.
+	/// </summary>
+	/// <param name="message"> The composed message. </param>
+	/// <returns> Return false if message is dropped. </returns>
+	bool Push(wstring&& message);
+
+	/// <summary>
+	/// Write all queued messages on calling thread.
+	/// </summary>
+	void Flush();
+
+	/// <summary>
+	/// Get count of dropped messages because ring buffer was full.
+	/// </summary>
+	size_t GetNumDropped() const { return _numDropped.load(memory_order_relaxed); }
+
+	/// <summary>
+	/// Get count of written messages.
+	/// </summary>
+	size_t GetNumWritten() const { return _numWritten.load(memory_order_relaxed); }
+
+	/// <summary>
+	/// Get approximate count of queued messages.
+	/// </summary>
+	size_t GetQueueDepth() const;
+
+private:
+	bool Pop(wstring& message);
+	void Worker();
+};
\ No newline at end of file
@@ -0,0 +1,274 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.filesystem;
+import SC.Runtime.Core;
+
+using namespace std;
+using namespace std::chrono;
+using namespace std::filesystem;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	class BinaryReader
+	{
+		istream& _stream;
+		uint64 _size = 0;
+
+	public:
+		BinaryReader(istream& stream) : _stream(stream)
+		{
+			if (_stream.seekg(0, ios::end))
+			{
+				_size = (uint64)_stream.tellg();
+				_stream.seekg(0, ios::beg);
+			}
+		}
+
+		template<class T>
+		bool Read(T& value)
+		{
+			_stream.read((char*)&value, sizeof(T));
+			return (bool)_stream;
+		}
+
+		bool ReadString(wstring& value)
+		{
+			// Length is read from file, so it is bounded by remaining bytes before allocating.
+			uint32 length = 0;
+			if (!Read(length) || (uint64)length * sizeof(wchar_t) > GetRemaining())
+			{
+				return false;
+			}
+
+			value.resize(length);
+			_stream.read((char*)value.data(), length * sizeof(wchar_t));
+			return (bool)_stream;
+		}
+
+		bool IsEnd()
+		{
+			return _stream.peek() == char_traits<char>::eof();
+		}
+
+		uint64 GetRemaining()
+		{
+			return _size - (uint64)_stream.tellg();
+		}
+	};
+
+	wstring_view VerbosityToString(uint8 verbosity)
+	{
+		switch ((ELogVerbosity)verbosity)
+		{
+		case Fatal: return L"Fatal";
+		case Error: return L"Error";
+		case Warning: return L"Warning";
+		case Info: return L"Info";
+		case Verbose: return L"Verbose";
+		default: return L"";
+		}
+	}
+}
+
+bool BinaryLogDecoder::Decode(const path& filepath, wostream& output)
+{
+	ifstream stream(filepath, ios::binary);
+	BinaryReader reader(stream);
+
+	uint32 magic = 0;
+	uint32 version = 0;
+	if (!reader.Read(magic) || !reader.Read(version) || magic != BinaryLogWriter::Magic || version != BinaryLogWriter::Version)
+	{
+		return false;
+	}
+
+	map<uint64, wstring> formats;
+	map<uint64, wstring> categories;
+	vector<Argument> args;
+
+	while (!reader.IsEnd())
+	{
+		EBinaryLogRecord type;
+		uint64 id = 0;
+		if (!reader.Read(type) || !reader.Read(id))
+		{
+			return false;
+		}
+
+		switch (type)
+		{
+		case EBinaryLogRecord::Format:
+			if (!reader.ReadString(formats[id]))
+			{
+				return false;
+			}
+			break;
+		case EBinaryLogRecord::Category:
+			if (!reader.ReadString(categories[id]))
+			{
+				return false;
+			}
+			break;
+		case EBinaryLogRecord::Message:
+		{
+			uint64 categoryId = 0;
+			uint8 verbosity = 0;
+			int64 timestamp = 0;
+			uint8 numArgs = 0;
+			if (!reader.Read(categoryId) || !reader.Read(verbosity) || !reader.Read(timestamp) || !reader.Read(numArgs))
+			{
+				return false;
+			}
+
+			args.clear();
+			for (uint8 i = 0; i < numArgs; ++i)
+			{
+				EBinaryLogArgument argType;
+				if (!reader.Read(argType))
+				{
+					return false;
+				}
+
+				bool bSucceeded = false;
+				switch (argType)
+				{
+				case EBinaryLogArgument::Int64:
+				{
+					int64 value = 0;
+					bSucceeded = reader.Read(value);
+					args.emplace_back(value);
+					break;
+				}
+				case EBinaryLogArgument::UInt64:
+				{
+					uint64 value = 0;
+					bSucceeded = reader.Read(value);
+					args.emplace_back(value);
+					break;
+				}
+				case EBinaryLogArgument::Double:
+				{
+					double value = 0;
+					bSucceeded = reader.Read(value);
+					args.emplace_back(value);
+					break;
+				}
+				case EBinaryLogArgument::Bool:
+				{
+					uint8 value = 0;
+					bSucceeded = reader.Read(value);
+					args.emplace_back(value != 0);
+					break;
+				}
+				case EBinaryLogArgument::String:
+				{
+					wstring value;
+					bSucceeded = reader.ReadString(value);
+					args.emplace_back(move(value));
+					break;
+				}
+				}
+
+				if (!bSucceeded)
+				{
+					return false;
+				}
+			}
+
+			system_clock::time_point timePoint{ system_clock::duration(timestamp) };
+			output << format(L"{}: Log{}: {}: {}\n", zoned_time(current_zone(), timePoint).get_local_time(), categories[categoryId], VerbosityToString(verbosity), FormatRecord(formats[id], args));
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+wstring BinaryLogDecoder::FormatRecord(wstring_view formatString, const vector<Argument>& args)
+{
+	wstring message;
+	size_t nextIndex = 0;
+
+	for (size_t i = 0; i < formatString.length(); ++i)
+	{
+		wchar_t ch = formatString[i];
+		if (ch == L'}' && i + 1 < formatString.length() && formatString[i + 1] == L'}')
+		{
+			message += L'}';
+			++i;
+			continue;
+		}
+
+		if (ch != L'{')
+		{
+			message += ch;
+			continue;
+		}
+
+		if (i + 1 < formatString.length() && formatString[i + 1] == L'{')
+		{
+			message += L'{';
+			++i;
+			continue;
+		}
+
+		// Parse replacement field that composed with argument index and format spec.
+		size_t close = formatString.find(L'}', i);
+		if (close == wstring_view::npos)
+		{
+			message += formatString.substr(i);
+			break;
+		}
+
+		wstring_view field = formatString.substr(i + 1, close - i - 1);
+		wstring_view spec;
+		if (size_t colon = field.find(L':'); colon != wstring_view::npos)
+		{
+			spec = field.substr(colon);
+			field = field.substr(0, colon);
+		}
+
+		// Malformed field is kept as written, so corrupted record does not abort decoding.
+		wstring_view placeholder = formatString.substr(i, close - i + 1);
+		size_t index = nextIndex++;
+		if (!field.empty())
+		{
+			try
+			{
+				index = (size_t)stoull(wstring(field));
+			}
+			catch (const exception&)
+			{
+				index = args.size();
+			}
+		}
+
+		if (index < args.size())
+		{
+			// Format each argument with its own spec, since argument types are known at runtime only.
+			wstring argFormat = format(L"{{{}}}", spec);
+			try
+			{
+				message += visit([&argFormat](auto& value) { return vformat(argFormat, make_wformat_args(value)); }, args[index]);
+			}
+			catch (const format_error&)
+			{
+				message += placeholder;
+			}
+		}
+		else
+		{
+			message += placeholder;
+		}
+
+		i = close;
+	}
+
+	return message;
+}
\ No newline at end of file
@@ -0,0 +1,30 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:BinaryLogDecoder;
+
+import std.core;
+import std.filesystem;
+import :PrimitiveTypes;
+import :BinaryLogWriter;
+
+using namespace std;
+
+/// <summary>
+/// Provide decoding function that format binary log stream written by <see cref="BinaryLogWriter"/> to text.
+/// </summary>
+export class BinaryLogDecoder abstract final
+{
+public:
+	/// <summary>
+	/// Decode binary log file to text. Each message is written as same form of text log.
+	/// </summary>
+	/// <param name="filepath"> The binary log file path. </param>
+	/// <param name="output"> The output text stream. </param>
+	/// <returns> Return false if file is not valid binary log or is truncated. </returns>
+	static bool Decode(const filesystem::path& filepath, wostream& output);
+
+private:
+	using Argument = variant<int64, uint64, double, bool, wstring>;
+
+	static wstring FormatRecord(wstring_view formatString, const vector<Argument>& args);
+};
\ No newline at end of file
@@ -0,0 +1,87 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+
+using namespace std;
+using namespace std::filesystem;
+
+namespace
+{
+	// Identifies writer instance, so thread that cached buffer of destroyed writer does not reuse it.
+	atomic<uint64> GNextSerial = 0;
+}
+
+BinaryLogWriter::BinaryLogWriter(const path& filepath, size_t bufferSize)
+	: _bufferSize(bufferSize)
+	, _serial(++GNextSerial)
+{
+	if (filepath.has_parent_path())
+	{
+		create_directories(filepath.parent_path());
+	}
+
+	_stream.open(filepath, ios::binary | ios::out | ios::trunc);
+	_stream.write((const char*)&Magic, sizeof(Magic));
+	_stream.write((const char*)&Version, sizeof(Version));
+}
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+	Flush();
+}
+
+void BinaryLogWriter::Flush()
+{
+	// Buffers are never removed until writer is destroyed. Lock each buffer before stream lock, same order as Write.
+	vector<ThreadBuffer*> buffers;
+	{
+		unique_lock lock(_lock);
+		buffers.reserve(_threadBuffers.size());
+		for (auto& buffer : _threadBuffers)
+		{
+			buffers.emplace_back(buffer.get());
+		}
+	}
+
+	for (auto& buffer : buffers)
+	{
+		unique_lock lock(buffer->Lock);
+		FlushThreadBuffer(*buffer);
+	}
+
+	unique_lock lock(_lock);
+	_stream.flush();
+}
+
+BinaryLogWriter::ThreadBuffer& BinaryLogWriter::GetThreadBuffer()
+{
+	thread_local uint64 cachedSerial = 0;
+	thread_local ThreadBuffer* cachedBuffer = nullptr;
+
+	if (cachedSerial != _serial)
+	{
+		auto buffer = make_unique<ThreadBuffer>();
+		buffer->Records.reserve(_bufferSize);
+
+		unique_lock lock(_lock);
+		cachedBuffer = _threadBuffers.emplace_back(move(buffer)).get();
+		cachedSerial = _serial;
+	}
+
+	return *cachedBuffer;
+}
+
+void BinaryLogWriter::FlushThreadBuffer(ThreadBuffer& buffer)
+{
+	if (buffer.Records.empty())
+	{
+		return;
+	}
+
+	unique_lock lock(_lock);
+	_stream.write((const char*)buffer.Records.data(), buffer.Records.size());
+	buffer.Records.clear();
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:BinaryLogWriter;
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import :Object;
+import :PrimitiveTypes;
+import :LogVerbosity;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents record type of binary log stream.
+/// </summary>
+export enum class EBinaryLogRecord : uint8
+{
+	/// <summary>
+	/// Define format string that referenced by identifier.
+	/// </summary>
+	Format = 1,
+
+	/// <summary>
+	/// Define category name that referenced by identifier.
+	/// </summary>
+	Category = 2,
+
+	/// <summary>
+	/// Log message that composed with format identifier and raw arguments.
+	/// </summary>
+	Message = 3,
+};
+
+/// <summary>
+/// Represents argument type of binary log message.
+/// </summary>
+export enum class EBinaryLogArgument : uint8
+{
+	Int64,
+	UInt64,
+	Double,
+	Bool,
+	String,
+};
+
+/// <summary>
+/// Represents format string of log. Identifier of format is computed at compile time on call site.
+/// </summary>
+export struct LogFormatString
+{
+	/// <summary>
+	/// The text format.
+	/// </summary>
+	wstring_view Text;
+
+	/// <summary>
+	/// The identifier of text format.
+	/// </summary>
+	uint64 Id = 0;
+
+	/// <summary>
+	/// Initialize new <see cref="LogFormatString"/> instance with constant text format.
+	/// </summary>
+	template<class T> requires is_convertible_v<const T&, wstring_view>
+	consteval LogFormatString(const T& text)
+		: Text(text)
+		, Id(ComputeId(Text))
+	{
+	}
+
+	/// <summary>
+	/// Compute identifier of format string or category name.
+	/// </summary>
+	static constexpr uint64 ComputeId(wstring_view text)
+	{
+		uint64 hash = 14695981039346656037ULL;
+		for (auto& ch : text)
+		{
+			hash = (hash ^ (uint64)ch) * 1099511628211ULL;
+		}
+		return hash;
+	}
+};
+
+/// <summary>
+/// Represents log writer that records format identifier and raw arguments instead of formatted message.
+/// Messages are formatted only when the stream is decoded by <see cref="BinaryLogDecoder"/>.
+/// Each thread records to its own buffer, so logging threads do not contend. Buffer is written to file when it is full or flushed,
+/// so records of different threads are not in time order in file.
+/// </summary>
+export class BinaryLogWriter : virtual public Object
+{
+public:
+	using Super = Object;
+
+	/// <summary>
+	/// The magic number at the beginning of binary log file.
+	/// </summary>
+	static constexpr uint32 Magic = 0x4C424353; // 'SCBL'
+
+	/// <summary>
+	/// The version of binary log file.
+	/// </summary>
+	static constexpr uint32 Version = 1;
+
+	/// <summary>
+	/// The default size of write buffer of each thread.
+	/// </summary>
+	static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+private:
+	struct ThreadBuffer
+	{
+		mutex Lock;
+		vector<uint8> Records;
+
+		// Strings that defined in records of this buffer or previously written records.
+		unordered_set<uint64> DefinedFormats;
+		unordered_set<uint64> DefinedCategories;
+	};
+
+	ofstream _stream;
+	const size_t _bufferSize;
+	const uint64 _serial;
+	mutex _lock;
+	vector<unique_ptr<ThreadBuffer>> _threadBuffers;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="BinaryLogWriter"/> instance.
+	/// </summary>
+	/// <param name="filepath"> The binary log file path. </param>
+	/// <param name="bufferSize"> The size of write buffer of each thread. Buffer is written to file when it is full. </param>
+	BinaryLogWriter(const filesystem::path& filepath, size_t bufferSize = DefaultBufferSize);
+	~BinaryLogWriter() override;
+
+	/// <summary>
+	/// Write log message.
+	/// </summary>
+	/// <param name="categoryId"> The identifier of category name. </param>
+	/// <param name="categoryName"> The category name. </param>
+	/// <param name="logVerbosity"> The log verbosity. </param>
+	/// <param name="format"> The text format. </param>
+	/// <param name="...args"> The formatter args. </param>
+	template<class... TArgs>
+	void Write(uint64 categoryId, wstring_view categoryName, ELogVerbosity logVerbosity, const LogFormatString& format, const TArgs&... args)
+	{
+		ThreadBuffer& buffer = GetThreadBuffer();
+		unique_lock lock(buffer.Lock);
+		vector<uint8>& record = buffer.Records;
+
+		// Each string is defined once in buffer before messages that refer it, so stream is decodable in file order.
+		if (buffer.DefinedFormats.emplace(format.Id).second)
+		{
+			Put(record, EBinaryLogRecord::Format);
+			Put(record, format.Id);
+			PutString(record, format.Text);
+		}
+
+		if (buffer.DefinedCategories.emplace(categoryId).second)
+		{
+			Put(record, EBinaryLogRecord::Category);
+			Put(record, categoryId);
+			PutString(record, categoryName);
+		}
+
+		Put(record, EBinaryLogRecord::Message);
+		Put(record, format.Id);
+		Put(record, categoryId);
+		Put(record, (uint8)logVerbosity);
+		Put(record, (int64)system_clock::now().time_since_epoch().count());
+		Put(record, (uint8)sizeof...(TArgs));
+		(PutArgument(record, args), ...);
+
+		if (record.size() >= _bufferSize)
+		{
+			FlushThreadBuffer(buffer);
+		}
+	}
+
+	/// <summary>
+	/// Write buffered records of all threads to file.
+	/// </summary>
+	void Flush();
+
+	/// <summary>
+	/// Get identifier of format string or category name.
+	/// </summary>
+	static constexpr uint64 GetHashCode(wstring_view text)
+	{
+		return LogFormatString::ComputeId(text);
+	}
+
+private:
+	template<class T> requires is_trivially_copyable_v<T>
+	static void Put(vector<uint8>& buffer, const T& value)
+	{
+		const size_t offset = buffer.size();
+		buffer.resize(offset + sizeof(T));
+		memcpy(buffer.data() + offset, &value, sizeof(T));
+	}
+
+	static void PutString(vector<uint8>& buffer, wstring_view text)
+	{
+		Put(buffer, (uint32)text.length());
+		const size_t offset = buffer.size();
+		buffer.resize(offset + text.length() * sizeof(wchar_t));
+		memcpy(buffer.data() + offset, text.data(), text.length() * sizeof(wchar_t));
+	}
+
+	template<class T>
+	static void PutArgument(vector<uint8>& buffer, const T& arg)
+	{
+		using U = remove_cvref_t<T>;
+
+		if constexpr (is_same_v<U, bool>)
+		{
+			Put(buffer, EBinaryLogArgument::Bool);
+			Put(buffer, (uint8)arg);
+		}
+		else if constexpr (is_same_v<U, wchar_t>)
+		{
+			Put(buffer, EBinaryLogArgument::String);
+			PutString(buffer, wstring_view(&arg, 1));
+		}
+		else if constexpr (is_integral_v<U> && is_signed_v<U>)
+		{
+			Put(buffer, EBinaryLogArgument::Int64);
+			Put(buffer, (int64)arg);
+		}
+		else if constexpr (is_integral_v<U>)
+		{
+			Put(buffer, EBinaryLogArgument::UInt64);
+			Put(buffer, (uint64)arg);
+		}
+		else if constexpr (is_floating_point_v<U>)
+		{
+			Put(buffer, EBinaryLogArgument::Double);
+			Put(buffer, (double)arg);
+		}
+		else if constexpr (is_convertible_v<const U&, wstring_view>)
+		{
+			Put(buffer, EBinaryLogArgument::String);
+			PutString(buffer, wstring_view(arg));
+		}
+		else
+		{
+			// Argument that have no raw representation is formatted alone.
+			Put(buffer, EBinaryLogArgument::String);
+			PutString(buffer, std::format(L"{}", arg));
+		}
+	}
+
+	ThreadBuffer& GetThreadBuffer();
+	void FlushThreadBuffer(ThreadBuffer& buffer);
+};
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 import std.core;
 import std.filesystem;
+import std.threading;
 import SC.Runtime.Core;
 import SC.Runtime.Core.Internal;
 
@@ -12,9 +13,12 @@ using namespace std::filesystem;
 using enum ELogVerbosity;
 
 optional<FileReference> LogCategory::_file;
+unique_ptr<AsyncLogWriter> LogCategory::_asyncWriter;
+unique_ptr<BinaryLogWriter> LogCategory::_binaryWriter;
 
 LogCategory::LogCategory(wstring_view categoryName)
 	: _name(categoryName)
+	, _id(BinaryLogWriter::GetHashCode(categoryName))
 {
 }
 
@@ -35,15 +39,38 @@ wstring_view LogCategory::VerbosityToString(ELogVerbosity verbosity)
 	}
 }
 
-void LogCategory::OnLog(ELogVerbosity logVerbosity, wstring_view message)
+FileReference& LogCategory::GetLogFile()
 {
 	if (!_file.has_value())
 	{
 		_file = FileReference(format(L"Saved\\Logs\\{}_{:%F}.log", L"Logs", zoned_time(system_clock::now())));
 	}
 
-	wfstream& stream = _file.value().OpenSharedStream(this, ios::app, true);
+	return _file.value();
+}
+
+void LogCategory::OnLog(ELogVerbosity logVerbosity, wstring_view message)
+{
 	wstring composed = format(L"{}: Log{}: {}: {}\n", zoned_time(system_clock::now()).get_local_time(), _name, VerbosityToString(logVerbosity), message);
+
+	if (_asyncWriter)
+	{
+		if (logVerbosity != Fatal)
+		{
+			// Writer thread writes message to file and debug output in batch.
+			_asyncWriter->Push(move(composed));
+			return;
+		}
+
+		// Process will be terminated. Write all queued messages before fatal message.
+		_asyncWriter->Flush();
+	}
+
+	// Tick functions can log from worker threads concurrently.
+	static mutex lock;
+	unique_lock guard(lock);
+
+	wfstream& stream = GetLogFile().OpenSharedStream(this, ios::app, true);
 	if (stream.is_open())
 	{
 		stream << composed;
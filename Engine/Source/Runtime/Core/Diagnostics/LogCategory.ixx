@@ -7,6 +7,8 @@ import :Object;
 import :PrimitiveTypes;
 import :LogVerbosity;
 import :FileReference;
+import :AsyncLogWriter;
+import :BinaryLogWriter;
 
 using enum ELogVerbosity;
 
@@ -18,7 +20,11 @@ export class LogCategory : virtual public Object
 	friend class LogSystem;
 
 	static std::optional<FileReference> _file;
+	static std::unique_ptr<AsyncLogWriter> _asyncWriter;
+	static std::unique_ptr<BinaryLogWriter> _binaryWriter;
 	std::wstring _name;
+	uint64 _id = 0;
+	std::atomic<ELogVerbosity> _verbosity = Verbose;
 
 public:
 	/// <summary>
@@ -28,8 +34,26 @@ public:
 	LogCategory(std::wstring_view categoryName);
 	~LogCategory();
 
+	/// <summary>
+	/// Set the most verbose level that this category accepts. Fatal log is always accepted.
+	/// </summary>
+	/// <param name="verbosity"> The log verbosity. </param>
+	inline void SetVerbosity(ELogVerbosity verbosity) { _verbosity.store(verbosity, std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Get the most verbose level that this category accepts.
+	/// </summary>
+	inline ELogVerbosity GetVerbosity() const { return _verbosity.load(std::memory_order_relaxed); }
+
+	/// <summary>
+	/// Indicate this category accepts log of specified verbosity.
+	/// </summary>
+	/// <param name="verbosity"> The log verbosity. </param>
+	inline bool IsEnabled(ELogVerbosity verbosity) const { return verbosity <= GetVerbosity(); }
+
 private:
 	static std::wstring_view VerbosityToString(ELogVerbosity verbosity);
+	static FileReference& GetLogFile();
 
 protected:
 	/// <summary>
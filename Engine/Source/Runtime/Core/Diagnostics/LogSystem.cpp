@@ -1,9 +1,11 @@
 // Copyright 2020-2021 Aumoa.lib. All right reserved.
 
 import std.core;
+import std.filesystem;
 import SC.Runtime.Core;
 
 using namespace std;
+using namespace std::chrono;
 
 LogSystem::fatal_exception::fatal_exception(string_view message) : exception((_storage = message).c_str())
 {
@@ -17,4 +19,73 @@ void LogSystem::InternalLog(LogCategory& category, ELogVerbosity logVerbosity, w
 	{
 		throw fatal_exception(StringUtils::AsMultibyte(message));
 	}
+}
+
+void LogSystem::SetAsyncLogging(bool bEnable)
+{
+	if (bEnable == IsAsyncLogging())
+	{
+		return;
+	}
+
+	if (bEnable)
+	{
+		LogCategory::_asyncWriter = make_unique<AsyncLogWriter>(&LogCategory::GetLogFile());
+	}
+	else
+	{
+		// Writer thread writes remaining messages before exit.
+		LogCategory::_asyncWriter.reset();
+	}
+}
+
+bool LogSystem::IsAsyncLogging()
+{
+	return (bool)LogCategory::_asyncWriter;
+}
+
+void LogSystem::SetBinaryLogging(bool bEnable)
+{
+	if (bEnable == IsBinaryLogging())
+	{
+		return;
+	}
+
+	if (bEnable)
+	{
+		filesystem::path filepath = format(L"Saved\\Logs\\{}_{:%F}.sclog", L"Logs", zoned_time(system_clock::now()));
+		LogCategory::_binaryWriter = make_unique<BinaryLogWriter>(filepath);
+	}
+	else
+	{
+		LogCategory::_binaryWriter.reset();
+	}
+}
+
+bool LogSystem::IsBinaryLogging()
+{
+	return (bool)LogCategory::_binaryWriter;
+}
+
+void LogSystem::Flush()
+{
+	if (LogCategory::_asyncWriter)
+	{
+		LogCategory::_asyncWriter->Flush();
+	}
+
+	if (LogCategory::_binaryWriter)
+	{
+		LogCategory::_binaryWriter->Flush();
+	}
+}
+
+size_t LogSystem::GetNumDroppedMessages()
+{
+	return LogCategory::_asyncWriter ? LogCategory::_asyncWriter->GetNumDropped() : 0;
+}
+
+size_t LogSystem::GetQueueDepth()
+{
+	return LogCategory::_asyncWriter ? LogCategory::_asyncWriter->GetQueueDepth() : 0;
 }
\ No newline at end of file
@@ -6,6 +6,7 @@ import std.core;
 import :LogVerbosity;
 import :LogCategory;
 import :StringUtils;
+import :BinaryLogWriter;
 
 using namespace std;
 
@@ -24,20 +25,103 @@ export class LogSystem abstract final
 
 public:
 	/// <summary>
-	/// Log message.
+	/// Log message with verbosity that is constant on call site. Log that is more verbose than <see cref="CompiledLogVerbosity"/>
+	/// is removed at compile time, so prefer this to logging with runtime verbosity.
+	/// </summary>
+	/// <typeparam name="Verbosity"> The log verbosity. </typeparam>
+	/// <typeparam name="...TArgs"> Type of formatter args. </typeparam>
+	/// <param name="category"> The log category. </param>
+	/// <param name="format"> The constant text format. Identifier of format is computed at compile time. </param>
+	/// <param name="...args"> The formatter args. </param>
+	template<ELogVerbosity Verbosity, class... TArgs>
+	static void Log(LogCategory& category, LogFormatString format, TArgs&&... args)
+	{
+		if constexpr (Verbosity <= CompiledLogVerbosity)
+		{
+			if (category.IsEnabled(Verbosity))
+			{
+				InternalLogFormat(category, Verbosity, format, forward<TArgs>(args)...);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Log message with verbosity that is decided at runtime.
 	/// </summary>
 	/// <typeparam name="...TArgs"> Type of formatter args. </typeparam>
 	/// <param name="category"> The log category. </param>
 	/// <param name="logVerbosity"> The log verbosity. </param>
-	/// <param name="format"> The text format. </param>
+	/// <param name="format"> The constant text format. Identifier of format is computed at compile time. </param>
 	/// <param name="...args"> The formatter args. </param>
 	template<class... TArgs>
-	static void Log(LogCategory& category, ELogVerbosity logVerbosity, wstring_view format, TArgs&&... args)
+	static void Log(LogCategory& category, ELogVerbosity logVerbosity, LogFormatString format, TArgs&&... args)
 	{
-		wstring message = std::format(format, forward<TArgs>(args)...);
-		InternalLog(category, logVerbosity, message);
+		// Check verbosity before formatting, so filtered log costs single branch.
+		if (logVerbosity <= CompiledLogVerbosity && category.IsEnabled(logVerbosity))
+		{
+			InternalLogFormat(category, logVerbosity, format, forward<TArgs>(args)...);
+		}
 	}
 
+	/// <summary>
+	/// Enable or disable asynchronous logging. Messages are written by background thread while enabled.
+	/// Should not be called while other threads are logging.
+	/// </summary>
+	/// <param name="bEnable"> Enable asynchronous logging. </param>
+	static void SetAsyncLogging(bool bEnable);
+
+	/// <summary>
+	/// Indicate asynchronous logging is enabled.
+	/// </summary>
+	static bool IsAsyncLogging();
+
+	/// <summary>
+	/// Enable or disable binary logging. Messages are recorded to binary log file without formatting while enabled,
+	/// except fatal message that also logged as text.
+	/// Should not be called while other threads are logging.
+	/// </summary>
+	/// <param name="bEnable"> Enable binary logging. </param>
+	static void SetBinaryLogging(bool bEnable);
+
+	/// <summary>
+	/// Indicate binary logging is enabled.
+	/// </summary>
+	static bool IsBinaryLogging();
+
+	/// <summary>
+	/// Write all queued messages on calling thread.
+	/// </summary>
+	static void Flush();
+
+	/// <summary>
+	/// Get count of messages that dropped because asynchronous log queue was full.
+	/// </summary>
+	static size_t GetNumDroppedMessages();
+
+	/// <summary>
+	/// Get approximate count of messages that queued to asynchronous log writer.
+	/// </summary>
+	static size_t GetQueueDepth();
+
 private:
+	template<class... TArgs>
+	static void InternalLogFormat(LogCategory& category, ELogVerbosity logVerbosity, const LogFormatString& format, TArgs&&... args)
+	{
+		// Record format identifier and raw arguments. Message is formatted by BinaryLogDecoder.
+		if (LogCategory::_binaryWriter)
+		{
+			LogCategory::_binaryWriter->Write(category._id, category._name, logVerbosity, format, args...);
+			if (logVerbosity != ELogVerbosity::Fatal)
+			{
+				return;
+			}
+
+			LogCategory::_binaryWriter->Flush();
+		}
+
+		wstring message = std::format(format.Text, forward<TArgs>(args)...);
+		InternalLog(category, logVerbosity, message);
+	}
+
 	static void InternalLog(LogCategory& category, ELogVerbosity logVerbosity, wstring& message);
 };
\ No newline at end of file
@@ -31,4 +31,14 @@ export enum class ELogVerbosity
 	/// Display verbose logging.
 	/// </summary>
 	Verbose,
-};
\ No newline at end of file
+};
+
+/// <summary>
+/// The most verbose level that compiled into binary. LogSystem::Log&lt;Verbosity&gt; calls above this level are removed
+/// at compile time. Define SHIPPING to strip Info and Verbose logs.
+/// </summary>
+#if defined(SHIPPING)
+export constexpr ELogVerbosity CompiledLogVerbosity = ELogVerbosity::Warning;
+#else
+export constexpr ELogVerbosity CompiledLogVerbosity = ELogVerbosity::Verbose;
+#endif
\ No newline at end of file
@@ -51,7 +51,7 @@ wfstream& FileReference::OpenSharedStream(const Object* sharingUser, ios_base::o
 {
 	if (sharingUser == nullptr)
 	{
-		LogSystem::Log(LogCore, Error, L"The sharing user is nullptr. Abort.");
+		LogSystem::Log<Error>(LogCore, L"The sharing user is nullptr. Abort.");
 		return _sharedstream;
 	}
 
@@ -73,7 +73,7 @@ void FileReference::CloseSharedStream(const Object* sharingUser)
 {
 	if (sharingUser == nullptr)
 	{
-		LogSystem::Log(LogCore, Error, L"The sharing user is nullptr. Abort.");
+		LogSystem::Log<Error>(LogCore, L"The sharing user is nullptr. Abort.");
 		return;
 	}
 
@@ -89,7 +89,7 @@ void FileReference::CloseSharedStream(const Object* sharingUser)
 		return;
 	}
 
-	LogSystem::Log(LogCore, Verbose, L"The user {} is not contained from shared stream users.", sharingUser->ToString());
+	LogSystem::Log<Verbose>(LogCore, L"The user {} is not contained from shared stream users.", sharingUser->ToString());
 }
 
 void FileReference::FlushAndCloseSharedStream()
@@ -7,22 +7,64 @@ using namespace std;
 
 using enum ELogVerbosity;
 
+namespace
+{
+	// Arena memory that reserved by CreateSubobject and not yet consumed by constructor of Object.
+	struct PendingArenaAllocation
+	{
+		ObjectArena* Arena = nullptr;
+		void* Memory = nullptr;
+		uint32 Size = 0;
+	};
+
+	thread_local PendingArenaAllocation GPendingAllocation;
+}
+
 Object::Object()
 {
+	PendingArenaAllocation& pending = GPendingAllocation;
+	if (pending.Memory != nullptr)
+	{
+		auto* begin = static_cast<uint8*>(pending.Memory);
+		auto* self = reinterpret_cast<uint8*>(this);
+		if (self >= begin && self < begin + pending.Size)
+		{
+			// This object is carved from arena. Subobjects of this object will use same arena.
+			_subobjectArena = pending.Arena;
+			_subobjectArena->AddRef();
+			_arenaMemory = pending.Memory;
+			_arenaSize = pending.Size;
+			pending = {};
+		}
+	}
 }
 
 Object::~Object() noexcept
 {
+	// Object is destroyed before flush, such as destroyed with its outer.
+	if (IsPendingKill())
+	{
+		PendingKillQueue::Cancel(_pendingKillIndex);
+		_pendingKillIndex = NotPendingKill;
+	}
+
 	if (_outer != nullptr)
 	{
 		_outer->InternalDetachSubobject(this);
 	}
 
 	// Destroy all subobjects.
-	for (auto it : _subobjects)
+	while (_firstSubobject != nullptr)
+	{
+		Object* subobject = _firstSubobject;
+		InternalDetachSubobject(subobject);
+		InternalDeleteObject(subobject);
+	}
+
+	if (_subobjectArena != nullptr)
 	{
-		it->_outer = nullptr;
-		delete it;
+		_subobjectArena->Release();
+		_subobjectArena = nullptr;
 	}
 }
 
@@ -56,42 +98,136 @@ void Object::DestroySubobject(Object* subobject)
 	Object* outer = subobject->_outer;
 	if (outer == nullptr)
 	{
-		LogSystem::Log(LogCore, Error, L"Request destroy subobject but target is not valid subobject. Outer is nullptr.");
+		LogSystem::Log<Error>(LogCore, L"Request destroy subobject but target is not valid subobject. Outer is nullptr.");
 		return;
 	}
 
 	outer->InternalDestroySubobject(subobject);
 }
 
+void Object::MarkPendingKill()
+{
+	if (IsPendingKill())
+	{
+		return;
+	}
+
+	_pendingKillIndex = PendingKillQueue::Enqueue(this);
+}
+
+void Object::EnableSubobjectArena(size_t blockSize)
+{
+	if (_subobjectArena != nullptr)
+	{
+		LogSystem::Log<Warning>(LogCore, L"Subobject arena is already enabled on this object. Abort.");
+		return;
+	}
+
+	_subobjectArena = new ObjectArena(blockSize);
+}
+
+void* Object::InternalAllocateSubobject(size_t size)
+{
+	void* memory = _subobjectArena->Allocate(size);
+	GPendingAllocation =
+	{
+		.Arena = _subobjectArena,
+		.Memory = memory,
+		.Size = (uint32)size
+	};
+	return memory;
+}
+
+void Object::InternalAbortAllocateSubobject(void* memory, size_t size)
+{
+	if (GPendingAllocation.Memory == memory)
+	{
+		GPendingAllocation = {};
+	}
+
+	_subobjectArena->Free(memory, size);
+}
+
 void Object::InternalDetachSubobject(Object* subobject)
 {
-	if (auto it = _subobjects.find(subobject); it != _subobjects.end())
+	if (subobject->_outer != this)
 	{
-		(*it)->_outer = nullptr;
-		_subobjects.erase(it);
+		LogSystem::Log<Error>(LogCore, L"Request destroy subobject but target is not valid subobject. Outer have not this subobject.");
 		return;
 	}
 
-	LogSystem::Log(LogCore, Error, L"Request destroy subobject but target is not valid subobject. Outer have not this subobject.");
+	if (subobject->_prevSibling != nullptr)
+	{
+		subobject->_prevSibling->_nextSibling = subobject->_nextSibling;
+	}
+	else
+	{
+		_firstSubobject = subobject->_nextSibling;
+	}
+
+	if (subobject->_nextSibling != nullptr)
+	{
+		subobject->_nextSibling->_prevSibling = subobject->_prevSibling;
+	}
+
+	subobject->_prevSibling = nullptr;
+	subobject->_nextSibling = nullptr;
+	subobject->_outer = nullptr;
 }
 
 void Object::InternalAttachSubobject(Object* subobject)
 {
-	_subobjects.emplace(subobject);
+	subobject->_prevSibling = nullptr;
+	subobject->_nextSibling = _firstSubobject;
+	if (_firstSubobject != nullptr)
+	{
+		_firstSubobject->_prevSibling = subobject;
+	}
+
+	_firstSubobject = subobject;
+	subobject->_outer = this;
 }
 
 void Object::InternalDestroySubobject(Object* subobject)
 {
-	if (auto it = _subobjects.find(subobject); it != _subobjects.end())
+	if (subobject->_outer != this)
 	{
-		Object* ptr = *it;
-		ptr->_outer = nullptr;
-		_subobjects.erase(it);
+		LogSystem::Log<Error>(LogCore, L"Request destroy subobject but target is not valid subobject. Outer have not this subobject.");
+		return;
+	}
+
+	InternalDetachSubobject(subobject);
+
+	// Will remove all subobjects on destructor of object.
+	InternalDeleteObject(subobject);
+}
 
-		// Will remove all subobjects on destructor of object.
-		delete ptr;
+void Object::InternalDeleteObject(Object* object)
+{
+	if (object->_arenaMemory == nullptr)
+	{
+		delete object;
 		return;
 	}
 
-	LogSystem::Log(LogCore, Error, L"Request destroy subobject but target is not valid subobject. Outer have not this subobject.");
+	// Object that carved from arena is destructed in place and memory is returned to arena.
+	// Arena will be deleted when it was the last allocation and the owner is already destroyed.
+	ObjectArena* arena = object->_subobjectArena;
+	void* memory = object->_arenaMemory;
+	size_t size = object->_arenaSize;
+
+	object->~Object();
+	arena->Free(memory, size);
+}
+
+void Object::InternalDestroyPendingKill(Object* object)
+{
+	if (object->_outer != nullptr)
+	{
+		object->_outer->InternalDestroySubobject(object);
+	}
+	else
+	{
+		InternalDeleteObject(object);
+	}
 }
\ No newline at end of file
@@ -4,6 +4,9 @@ export module SC.Runtime.Core:Object;
 
 import std.core;
 import :PrimitiveTypes;
+import :ObjectArena;
+import :PendingKillQueue;
+import :ObjectClass;
 
 using namespace std;
 
@@ -13,9 +16,25 @@ using namespace std;
 /// </summary>
 export class Object
 {
+	friend class PendingKillQueue;
+	static constexpr size_t NotPendingKill = numeric_limits<size_t>::max();
+
 	atomic<int32> _ref = 0;
+	uint32 _arenaSize = 0;
 	Object* _outer = nullptr;
-	set<Object*> _subobjects;
+	const ObjectClass* _class = nullptr;
+
+	// Subobjects are linked with intrusive list.
+	Object* _firstSubobject = nullptr;
+	Object* _prevSibling = nullptr;
+	Object* _nextSibling = nullptr;
+
+	// Arena that subobjects of this object are carved from, and memory of this object if it was carved from arena.
+	ObjectArena* _subobjectArena = nullptr;
+	void* _arenaMemory = nullptr;
+
+	// Index of slot in pending kill queue if this object is marked as pending kill.
+	size_t _pendingKillIndex = NotPendingKill;
 
 public:
 	/// <summary>
@@ -44,12 +63,64 @@ public:
 	template<class T, class... TArgs>
 	T* CreateSubobject(TArgs&&... args)
 	{
-		T* ptr = new T(forward<TArgs>(args)...);
-		_subobjects.emplace(ptr);
-		ptr->_outer = this;
+		T* ptr = nullptr;
+		if constexpr (alignof(T) <= ObjectArena::Alignment && sizeof(T) <= ObjectArena::MaxAllocationSize)
+		{
+			if (_subobjectArena != nullptr)
+			{
+				void* memory = InternalAllocateSubobject(sizeof(T));
+				try
+				{
+					ptr = new(memory) T(forward<TArgs>(args)...);
+				}
+				catch (...)
+				{
+					InternalAbortAllocateSubobject(memory, sizeof(T));
+					throw;
+				}
+			}
+		}
+
+		if (ptr == nullptr)
+		{
+			ptr = new T(forward<TArgs>(args)...);
+		}
+
+		ptr->_class = ObjectClass::StaticClass<T>();
+		InternalAttachSubobject(ptr);
 		return ptr;
 	}
 
+	/// <summary>
+	/// Get class of this object. Return nullptr if this object is not created by <see cref="CreateSubobject"/>.
+	/// </summary>
+	const ObjectClass* GetClass() const { return _class; }
+
+	/// <summary>
+	/// Indicate this object is instance of specified class or derived class.
+	/// </summary>
+	/// <param name="objectClass"> The class to test. </param>
+	bool IsA(const ObjectClass* objectClass) const
+	{
+		return _class != nullptr && _class->IsChildOf(objectClass);
+	}
+
+	/// <summary>
+	/// Indicate this object is instance of specified class or derived class.
+	/// T should be in the Super chain of the object class. Fall back to RTTI if the object class is unknown.
+	/// </summary>
+	/// <typeparam name="T"> The class to test. </typeparam>
+	template<class T>
+	bool IsA() const
+	{
+		if (_class == nullptr)
+		{
+			return dynamic_cast<const T*>(this) != nullptr;
+		}
+
+		return _class->IsChildOf(ObjectClass::StaticClass<T>());
+	}
+
 	/// <summary>
 	/// Get outer that owner of this object.
 	/// </summary>
@@ -68,8 +139,35 @@ public:
 	/// <param name="subobject"> The target object. </param>
 	static void DestroySubobject(Object* subobject);
 
+	/// <summary>
+	/// Mark this object as pending kill. The object will be destroyed on next flush of <see cref="PendingKillQueue"/>.
+	/// </summary>
+	void MarkPendingKill();
+
+	/// <summary>
+	/// Indicate this object is marked as pending kill and waiting to be destroyed.
+	/// </summary>
+	bool IsPendingKill() const { return _pendingKillIndex != NotPendingKill; }
+
+	/// <summary>
+	/// Carve all subobjects that created after this call, and their subobjects, from arena owned by this object.
+	/// The arena is released at once when this object and all objects that carved from it are destroyed.
+	/// The arena is single-threaded. Subobjects should be created and destroyed on thread that calls this function.
+	/// </summary>
+	/// <param name="blockSize"> The size of each block that arena reserves at once. </param>
+	void EnableSubobjectArena(size_t blockSize = ObjectArena::DefaultBlockSize);
+
+	/// <summary>
+	/// Get arena that subobjects are carved from. Return nullptr if subobjects are allocated from global heap.
+	/// </summary>
+	ObjectArena* GetSubobjectArena() const { return _subobjectArena; }
+
 private:
+	void* InternalAllocateSubobject(size_t size);
+	void InternalAbortAllocateSubobject(void* memory, size_t size);
 	void InternalDetachSubobject(Object* subobject);
 	void InternalAttachSubobject(Object* subobject);
 	void InternalDestroySubobject(Object* subobject);
+	static void InternalDeleteObject(Object* object);
+	static void InternalDestroyPendingKill(Object* object);
 };
\ No newline at end of file
@@ -0,0 +1,102 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+ObjectArena::ObjectArena(size_t blockSize)
+	: _blockSize(GetAllocationSize(max(blockSize, MaxAllocationSize)))
+	, _ownerThread(this_thread::get_id())
+{
+}
+
+ObjectArena::~ObjectArena()
+{
+	for (auto& block : _blocks)
+	{
+		::operator delete(block, align_val_t(Alignment));
+	}
+}
+
+void* ObjectArena::Allocate(size_t size)
+{
+	CheckOwnerThread();
+
+	const size_t actualSize = GetAllocationSize(size);
+	const size_t sizeClass = actualSize / Alignment - 1;
+
+	void* memory = nullptr;
+	if (FreeSlot* slot = _freeSlots[sizeClass]; slot != nullptr)
+	{
+		// Reuse slot that returned from destroyed object.
+		_freeSlots[sizeClass] = slot->Next;
+		memory = slot;
+	}
+	else
+	{
+		if (_cursor + actualSize > _end)
+		{
+			_cursor = AllocateBlock(_blockSize);
+			_end = _cursor + _blockSize;
+		}
+
+		memory = _cursor;
+		_cursor += actualSize;
+	}
+
+	_refCount.fetch_add(1, memory_order_relaxed);
+	++_numAllocations;
+	_usedBytes += actualSize;
+	return memory;
+}
+
+void ObjectArena::Free(void* memory, size_t size)
+{
+	CheckOwnerThread();
+
+	const size_t actualSize = GetAllocationSize(size);
+	const size_t sizeClass = actualSize / Alignment - 1;
+
+	auto* slot = static_cast<FreeSlot*>(memory);
+	slot->Next = _freeSlots[sizeClass];
+	_freeSlots[sizeClass] = slot;
+
+	--_numAllocations;
+	_usedBytes -= actualSize;
+	Release();
+}
+
+void ObjectArena::AddRef()
+{
+	_refCount.fetch_add(1, memory_order_relaxed);
+}
+
+void ObjectArena::Release()
+{
+	if (_refCount.fetch_sub(1, memory_order_acq_rel) == 1)
+	{
+		delete this;
+	}
+}
+
+uint8* ObjectArena::AllocateBlock(size_t size)
+{
+	auto* block = static_cast<uint8*>(::operator new(size, align_val_t(Alignment)));
+	_blocks.emplace_back(block);
+	return block;
+}
+
+void ObjectArena::CheckOwnerThread() const
+{
+#if defined(_DEBUG)
+	// Free lists are not synchronized. Objects that outered to arena owner should be created and destroyed on its thread.
+	if (this_thread::get_id() != _ownerThread)
+	{
+		LogSystem::Log<Fatal>(LogCore, L"Object arena is accessed on thread that is not owner of arena.");
+	}
+#endif
+}
\ No newline at end of file
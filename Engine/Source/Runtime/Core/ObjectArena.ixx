@@ -0,0 +1,124 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:ObjectArena;
+
+import std.core;
+import std.threading;
+import :PrimitiveTypes;
+
+using namespace std;
+
+/// <summary>
+/// Represents slab allocator that subobjects are carved from.
+/// The arena is owned by the outer that enabled it and by every allocation that is still alive,
+/// so all blocks are released at once when the last of them is gone.
+/// Allocation and free are not synchronized and must be called on thread that created arena.
+/// Only reference count is atomic, so that owner references can be released on any thread.
+/// </summary>
+export class ObjectArena
+{
+public:
+	/// <summary>
+	/// The alignment of every allocation.
+	/// </summary>
+	static constexpr size_t Alignment = 16;
+
+	/// <summary>
+	/// The largest allocation size that arena can serve. Larger objects are allocated from global heap.
+	/// </summary>
+	static constexpr size_t MaxAllocationSize = 2048;
+
+	/// <summary>
+	/// The default size of each block.
+	/// </summary>
+	static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+private:
+	struct FreeSlot
+	{
+		FreeSlot* Next;
+	};
+
+	static constexpr size_t NumSizeClasses = MaxAllocationSize / Alignment;
+
+	const size_t _blockSize;
+	vector<uint8*> _blocks;
+	uint8* _cursor = nullptr;
+	uint8* _end = nullptr;
+	FreeSlot* _freeSlots[NumSizeClasses] = {};
+
+	const thread::id _ownerThread;
+	atomic<size_t> _refCount = 1;
+	size_t _numAllocations = 0;
+	size_t _usedBytes = 0;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="ObjectArena"/> instance.
+	/// </summary>
+	/// <param name="blockSize"> The size of each block that arena reserves at once. </param>
+	ObjectArena(size_t blockSize = DefaultBlockSize);
+	ObjectArena(const ObjectArena&) = delete;
+	~ObjectArena();
+
+	/// <summary>
+	/// Allocate memory from arena on owner thread. The size should not be greater than <see cref="MaxAllocationSize"/>.
+	/// </summary>
+	/// <param name="size"> The allocation size. </param>
+	/// <returns> The allocated memory. </returns>
+	void* Allocate(size_t size);
+
+	/// <summary>
+	/// Return memory to arena on owner thread. Arena will be deleted if it was the last reference.
+	/// </summary>
+	/// <param name="memory"> The memory that allocated by <see cref="Allocate"/>. </param>
+	/// <param name="size"> The size that used to allocate. </param>
+	void Free(void* memory, size_t size);
+
+	/// <summary>
+	/// Add owner reference.
+	/// </summary>
+	void AddRef();
+
+	/// <summary>
+	/// Release owner reference. Arena will be deleted if it was the last reference.
+	/// </summary>
+	void Release();
+
+	/// <summary>
+	/// Get count of reserved blocks.
+	/// </summary>
+	size_t GetNumBlocks() const { return _blocks.size(); }
+
+	/// <summary>
+	/// Get total bytes that reserved from global heap.
+	/// </summary>
+	size_t GetReservedBytes() const { return _blocks.size() * _blockSize; }
+
+	/// <summary>
+	/// Get count of alive allocations.
+	/// </summary>
+	size_t GetNumAllocations() const { return _numAllocations; }
+
+	/// <summary>
+	/// Get bytes of alive allocations.
+	/// </summary>
+	size_t GetUsedBytes() const { return _usedBytes; }
+
+	/// <summary>
+	/// Get thread that created arena.
+	/// </summary>
+	thread::id GetOwnerThread() const { return _ownerThread; }
+
+	/// <summary>
+	/// Get allocation size that rounded up to size class.
+	/// </summary>
+	static constexpr size_t GetAllocationSize(size_t size)
+	{
+		return (size + Alignment - 1) & ~(Alignment - 1);
+	}
+
+private:
+	uint8* AllocateBlock(size_t size);
+	void CheckOwnerThread() const;
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+
+using namespace std;
+
+namespace
+{
+	struct ClassRegistry
+	{
+		mutex Lock;
+		map<size_t, unique_ptr<ObjectClass>> Classes;
+	};
+
+	ClassRegistry& GetClassRegistry()
+	{
+		static ClassRegistry registry;
+		return registry;
+	}
+}
+
+ObjectClass::ObjectClass(string_view name, size_t hashCode, const ObjectClass* super)
+	: _name(name)
+	, _hashCode(hashCode)
+	, _super(super)
+{
+	if (super != nullptr)
+	{
+		_depth = super->_depth + 1;
+		_ancestors.reserve(_depth + 1);
+		_ancestors.assign(super->_ancestors.begin(), super->_ancestors.end());
+	}
+
+	_ancestors.emplace_back(this);
+}
+
+size_t ObjectClass::GetNumClasses()
+{
+	ClassRegistry& registry = GetClassRegistry();
+	unique_lock lock(registry.Lock);
+	return registry.Classes.size();
+}
+
+const ObjectClass* ObjectClass::Register(string_view name, size_t hashCode, const ObjectClass* super)
+{
+	ClassRegistry& registry = GetClassRegistry();
+	unique_lock lock(registry.Lock);
+
+	// Class is registered already by other static library that instantiate same type.
+	if (auto it = registry.Classes.find(hashCode); it != registry.Classes.end())
+	{
+		return it->second.get();
+	}
+
+	auto newClass = make_unique<ObjectClass>(name, hashCode, super);
+	ObjectClass* ptr = newClass.get();
+	registry.Classes.emplace(hashCode, move(newClass));
+	return ptr;
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:ObjectClass;
+
+import std.core;
+import :PrimitiveTypes;
+import :UniqueType;
+
+using namespace std;
+
+/// <summary>
+/// Represents runtime class information of object.
+/// Each class stores its ancestors indexed by depth of hierarchy, so checking class hierarchy is one compare and one load without RTTI.
+/// Class information is immutable after registration, so it can be read from any thread.
+/// </summary>
+export class ObjectClass
+{
+	string_view _name;
+	size_t _hashCode = 0;
+	const ObjectClass* _super = nullptr;
+	size_t _depth = 0;
+	vector<const ObjectClass*> _ancestors;
+
+public:
+	ObjectClass(string_view name, size_t hashCode, const ObjectClass* super);
+	ObjectClass(const ObjectClass&) = delete;
+
+	/// <summary>
+	/// Get unique name of class.
+	/// </summary>
+	inline string_view GetName() const { return _name; }
+
+	/// <summary>
+	/// Get hash code that generated by <see cref="UniqueType"/>.
+	/// </summary>
+	inline size_t GetHashCode() const { return _hashCode; }
+
+	/// <summary>
+	/// Get super class. Return nullptr if this is root class.
+	/// </summary>
+	inline const ObjectClass* GetSuper() const { return _super; }
+
+	/// <summary>
+	/// Indicate this class is same or derived class of specified class.
+	/// </summary>
+	/// <param name="base"> The base class. </param>
+	inline bool IsChildOf(const ObjectClass* base) const
+	{
+		return base->_depth <= _depth && _ancestors[base->_depth] == base;
+	}
+
+	/// <summary>
+	/// Get class information of specified type. The class and its super classes are registered at first call, and it is thread-safe.
+	/// </summary>
+	/// <typeparam name="T"> The class type. Super class is resolved by T::Super, so each class should declare its direct base as Super. </typeparam>
+	template<class T>
+	static const ObjectClass* StaticClass()
+	{
+		static const ObjectClass* myclass = Register(UniqueType<T>::UniqueName, UniqueType<T>::HashCode, GetSuperClass<T>());
+		return myclass;
+	}
+
+	/// <summary>
+	/// Get count of registered classes.
+	/// </summary>
+	static size_t GetNumClasses();
+
+private:
+	template<class T>
+	static const ObjectClass* GetSuperClass()
+	{
+		if constexpr (requires { typename T::Super; })
+		{
+			if constexpr (!is_same_v<typename T::Super, T>)
+			{
+				static_assert(is_base_of_v<typename T::Super, T>, "T::Super should be base class of T.");
+				return StaticClass<typename T::Super>();
+			}
+		}
+
+		return nullptr;
+	}
+
+	static const ObjectClass* Register(string_view name, size_t hashCode, const ObjectClass* super);
+};
\ No newline at end of file
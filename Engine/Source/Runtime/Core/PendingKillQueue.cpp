@@ -0,0 +1,85 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+
+using namespace std;
+using namespace std::chrono;
+
+vector<Object*> PendingKillQueue::_queue;
+size_t PendingKillQueue::_head = 0;
+size_t PendingKillQueue::_numPending = 0;
+size_t PendingKillQueue::_totalDestroyed = 0;
+PendingKillFlushStats PendingKillQueue::_lastFlushStats;
+
+PendingKillFlushStats PendingKillQueue::Flush(optional<duration<float>> timeBudget)
+{
+	steady_clock::time_point begin = steady_clock::now();
+	PendingKillFlushStats stats;
+
+	// Objects that enqueued while flushing are destroyed on this flush too.
+	while (_head < _queue.size())
+	{
+		Object* object = _queue[_head];
+		_queue[_head++] = nullptr;
+
+		// Slot is null if object is already destroyed with its outer.
+		if (object == nullptr)
+		{
+			continue;
+		}
+
+		object->_pendingKillIndex = Object::NotPendingKill;
+		--_numPending;
+		Object::InternalDestroyPendingKill(object);
+		++stats.NumDestroyed;
+
+		if (timeBudget.has_value() && steady_clock::now() - begin >= timeBudget.value())
+		{
+			break;
+		}
+	}
+
+	Compact();
+
+	stats.NumRemaining = _numPending;
+	stats.Elapsed = steady_clock::now() - begin;
+	_totalDestroyed += stats.NumDestroyed;
+	_lastFlushStats = stats;
+	return stats;
+}
+
+size_t PendingKillQueue::Enqueue(Object* object)
+{
+	++_numPending;
+	_queue.emplace_back(object);
+	return _queue.size() - 1;
+}
+
+void PendingKillQueue::Cancel(size_t index)
+{
+	_queue[index] = nullptr;
+	--_numPending;
+}
+
+void PendingKillQueue::Compact()
+{
+	if (_head == 0)
+	{
+		return;
+	}
+
+	// Move remaining objects to front and update indices that objects refer.
+	size_t count = 0;
+	for (size_t i = _head; i < _queue.size(); ++i)
+	{
+		if (Object* object = _queue[i]; object != nullptr)
+		{
+			object->_pendingKillIndex = count;
+			_queue[count++] = object;
+		}
+	}
+
+	_queue.resize(count);
+	_head = 0;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:PendingKillQueue;
+
+import std.core;
+import :PrimitiveTypes;
+
+using namespace std;
+using namespace std::chrono;
+
+export class Object;
+
+/// <summary>
+/// Represents statistics of single flush of <see cref="PendingKillQueue"/>.
+/// </summary>
+export struct PendingKillFlushStats
+{
+	/// <summary>
+	/// The count of objects that destroyed on this flush.
+	/// </summary>
+	size_t NumDestroyed = 0;
+
+	/// <summary>
+	/// The count of objects that remained to next flush because time budget is exceeded.
+	/// </summary>
+	size_t NumRemaining = 0;
+
+	/// <summary>
+	/// The elapsed time of this flush.
+	/// </summary>
+	duration<float> Elapsed = 0s;
+};
+
+/// <summary>
+/// Provide queue that objects marked as pending kill are waiting to be destroyed.
+/// The queue is flushed at frame boundary, so destruction does not spike in the middle of frame.
+/// All functions should be called on game thread.
+/// </summary>
+export class PendingKillQueue abstract final
+{
+	static vector<Object*> _queue;
+	static size_t _head;
+	static size_t _numPending;
+	static size_t _totalDestroyed;
+	static PendingKillFlushStats _lastFlushStats;
+
+public:
+	/// <summary>
+	/// Destroy objects that marked as pending kill.
+	/// </summary>
+	/// <param name="timeBudget"> The time budget. Remaining objects are destroyed on next flush. At least one object is destroyed on each flush. </param>
+	/// <returns> The statistics of this flush. </returns>
+	static PendingKillFlushStats Flush(optional<duration<float>> timeBudget = nullopt);
+
+	/// <summary>
+	/// Get count of objects that waiting to be destroyed.
+	/// </summary>
+	static size_t GetNumPending() { return _numPending; }
+
+	/// <summary>
+	/// Get total count of objects that destroyed by flush.
+	/// </summary>
+	static size_t GetTotalDestroyed() { return _totalDestroyed; }
+
+	/// <summary>
+	/// Get statistics of last flush.
+	/// </summary>
+	static const PendingKillFlushStats& GetLastFlushStats() { return _lastFlushStats; }
+
+public /*internal*/:
+	static size_t Enqueue(Object* object);
+	static void Cancel(size_t index);
+
+private:
+	static void Compact();
+};
\ No newline at end of file
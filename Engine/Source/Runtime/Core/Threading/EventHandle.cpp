@@ -1,8 +1,11 @@
 // Copyright 2020-2021 Aumoa.lib. All right reserved.
 
+#if defined(_WIN32)
 #include <Windows.h>
+#endif
 
 import std.core;
+import std.threading;
 import SC.Runtime.Core;
 
 using namespace std;
@@ -10,12 +13,14 @@ using namespace std::chrono;
 
 using enum ELogVerbosity;
 
+#if defined(_WIN32)
+
 EventHandle::EventHandle() : Super()
 {
 	_handle = CreateEventExW(nullptr, nullptr, 0, GENERIC_ALL);
 	if (_handle == nullptr)
 	{
-		LogSystem::Log(LogCore, Error, L"Could not create event handle. GetLastError(): {}", GetLastError());
+		LogSystem::Log<Error>(LogCore, L"Could not create event handle. GetLastError(): {}", GetLastError());
 		return;
 	}
 }
@@ -51,4 +56,51 @@ void EventHandle::Set()
 void EventHandle::Reset()
 {
 	ResetEvent(_handle);
-}
\ No newline at end of file
+}
+
+#else
+
+EventHandle::EventHandle() : Super()
+{
+}
+
+EventHandle::~EventHandle()
+{
+}
+
+auto EventHandle::Wait(milliseconds timeout) -> EStatus
+{
+	unique_lock lock(_lock);
+	auto isSignaled = [this]() { return _bSignaled; };
+
+	// Infinite timeout is finite duration for condition variable, so wait without timeout like system event.
+	if (timeout == InfiniteTimeout)
+	{
+		_signal.wait(lock, isSignaled);
+	}
+	else if (!_signal.wait_for(lock, timeout, isSignaled))
+	{
+		return EStatus::Timeout;
+	}
+
+	// Auto-reset like system event.
+	_bSignaled = false;
+	return EStatus::Succeeded;
+}
+
+void EventHandle::Set()
+{
+	{
+		unique_lock lock(_lock);
+		_bSignaled = true;
+	}
+	_signal.notify_one();
+}
+
+void EventHandle::Reset()
+{
+	unique_lock lock(_lock);
+	_bSignaled = false;
+}
+
+#endif
\ No newline at end of file
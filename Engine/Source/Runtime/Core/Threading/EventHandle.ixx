@@ -3,6 +3,7 @@
 export module SC.Runtime.Core:EventHandle;
 
 import std.core;
+import std.threading;
 import :PrimitiveTypes;
 import :Object;
 
@@ -10,7 +11,7 @@ using namespace std;
 using namespace std::chrono;
 
 /// <summary>
-/// The system event handle.
+/// The auto-reset event. Use system event handle on Windows to interact with native API, otherwise use condition variable.
 /// </summary>
 export class EventHandle : virtual public Object
 {
@@ -38,8 +39,18 @@ public:
 		Failed,
 	};
 
+	/// <summary>
+	/// The timeout that waits without time limit. Same value with INFINITE of Win32.
+	/// </summary>
+	static constexpr milliseconds InfiniteTimeout = 0xFFFFFFFFms;
+
 private:
 	void* _handle = nullptr;
+#if !defined(_WIN32)
+	mutex _lock;
+	condition_variable _signal;
+	bool _bSignaled = false;
+#endif
 
 public:
 	/// <summary>
@@ -51,8 +62,8 @@ public:
 	/// <summary>
 	/// Wait for signal.
 	/// </summary>
-	/// <param name="timeout"> Thread will be return forcely with failed status at timed out. </param>
-	EStatus Wait(milliseconds timeout = 0xFFFFFFFFms);
+	/// <param name="timeout"> Thread will be return forcely with failed status at timed out. <see cref="InfiniteTimeout"/> waits without time limit. </param>
+	EStatus Wait(milliseconds timeout = InfiniteTimeout);
 
 	/// <summary>
 	/// Set event to signal state.
@@ -65,7 +76,7 @@ public:
 	void Reset();
 
 	/// <summary>
-	/// Get native event handle.
+	/// Get native event handle. Return nullptr if platform has no native event.
 	/// </summary>
 	void* GetHandle() const { return _handle; }
 };
\ No newline at end of file
@@ -0,0 +1,491 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	/// Chase-Lev work-stealing deque. Owner pushes and pops at bottom without lock, and thieves steal at top.
+	class WorkStealingDeque
+	{
+		struct Ring
+		{
+			int64 Capacity;
+			unique_ptr<atomic<Job*>[]> Items;
+
+			Ring(int64 capacity)
+				: Capacity(capacity)
+				, Items(make_unique<atomic<Job*>[]>((size_t)capacity))
+			{
+			}
+
+			Job* Get(int64 index) const { return Items[(size_t)(index & (Capacity - 1))].load(memory_order_relaxed); }
+			void Put(int64 index, Job* job) { Items[(size_t)(index & (Capacity - 1))].store(job, memory_order_relaxed); }
+		};
+
+		static constexpr int64 InitialCapacity = 256;
+
+		atomic<int64> _top = 0;
+		atomic<int64> _bottom = 0;
+		atomic<Ring*> _ring;
+
+		// Thieves could read old ring while owner grows, so old rings are kept until deque is destroyed.
+		vector<unique_ptr<Ring>> _rings;
+
+	public:
+		WorkStealingDeque()
+		{
+			_rings.emplace_back(make_unique<Ring>(InitialCapacity));
+			_ring.store(_rings.back().get(), memory_order_relaxed);
+		}
+
+		~WorkStealingDeque()
+		{
+			while (Job* job = Pop())
+			{
+				delete job;
+			}
+		}
+
+		void Push(Job* job)
+		{
+			int64 b = _bottom.load(memory_order_relaxed);
+			int64 t = _top.load(memory_order_acquire);
+			Ring* ring = _ring.load(memory_order_relaxed);
+			if (b - t > ring->Capacity - 1)
+			{
+				ring = Grow(ring, b, t);
+			}
+
+			ring->Put(b, job);
+			atomic_thread_fence(memory_order_release);
+			_bottom.store(b + 1, memory_order_relaxed);
+		}
+
+		Job* Pop()
+		{
+			int64 b = _bottom.load(memory_order_relaxed) - 1;
+			Ring* ring = _ring.load(memory_order_relaxed);
+			_bottom.store(b, memory_order_relaxed);
+			atomic_thread_fence(memory_order_seq_cst);
+			int64 t = _top.load(memory_order_relaxed);
+
+			if (t > b)
+			{
+				// Deque is empty.
+				_bottom.store(b + 1, memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = ring->Get(b);
+			if (t == b)
+			{
+				// Last job. Race with thieves.
+				if (!_top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+				{
+					job = nullptr;
+				}
+				_bottom.store(b + 1, memory_order_relaxed);
+			}
+
+			return job;
+		}
+
+		Job* Steal()
+		{
+			int64 t = _top.load(memory_order_acquire);
+			atomic_thread_fence(memory_order_seq_cst);
+			int64 b = _bottom.load(memory_order_acquire);
+			if (t >= b)
+			{
+				return nullptr;
+			}
+
+			Ring* ring = _ring.load(memory_order_acquire);
+			Job* job = ring->Get(t);
+			if (!_top.compare_exchange_strong(t, t + 1, memory_order_seq_cst, memory_order_relaxed))
+			{
+				// Lost race with owner or other thief.
+				return nullptr;
+			}
+
+			return job;
+		}
+
+	private:
+		Ring* Grow(Ring* ring, int64 b, int64 t)
+		{
+			auto grown = make_unique<Ring>(ring->Capacity * 2);
+			for (int64 i = t; i < b; ++i)
+			{
+				grown->Put(i, ring->Get(i));
+			}
+
+			Ring* ptr = grown.get();
+			_rings.emplace_back(move(grown));
+			_ring.store(ptr, memory_order_release);
+			return ptr;
+		}
+	};
+
+	struct SharedQueue
+	{
+		mutex Lock;
+		deque<Job*> Jobs;
+	};
+
+	struct JobSystemState
+	{
+		vector<unique_ptr<WorkStealingDeque>> Queues;
+
+		// Non-worker threads could schedule concurrently, so they share queue with lock.
+		SharedQueue Shared;
+		vector<thread> Workers;
+		atomic<bool> bRunning = false;
+		atomic<size_t> NumPending = 0;
+		mutex SleepLock;
+		condition_variable Wakeup;
+	};
+
+	JobSystemState GState;
+
+	constexpr size_t NonWorkerIndex = numeric_limits<size_t>::max();
+	thread_local size_t GWorkerIndex = NonWorkerIndex;
+
+	Job* PopShared()
+	{
+		unique_lock lock(GState.Shared.Lock);
+		if (GState.Shared.Jobs.empty())
+		{
+			return nullptr;
+		}
+
+		Job* job = GState.Shared.Jobs.front();
+		GState.Shared.Jobs.pop_front();
+		return job;
+	}
+}
+
+JobCounter::JobCounter()
+{
+}
+
+JobCounter::~JobCounter()
+{
+}
+
+void JobCounter::Increment(size_t count)
+{
+	_count.fetch_add(count, memory_order_acq_rel);
+}
+
+void JobCounter::Decrement()
+{
+	vector<Job> continuations;
+	size_t count = _count.load(memory_order_acquire);
+	while (true)
+	{
+		if (count != 1)
+		{
+			if (_count.compare_exchange_weak(count, count - 1, memory_order_acq_rel))
+			{
+				return;
+			}
+			continue;
+		}
+
+		// Counter reaches zero only while holding lock, so waiter that acquired lock after zero
+		// can destroy this counter safely.
+		unique_lock lock(_lock);
+		if (_count.compare_exchange_strong(count, 0))
+		{
+			continuations.swap(_continuations);
+			if (_numWaiters.load() != 0)
+			{
+				unique_lock sleepLock(GState.SleepLock);
+				GState.Wakeup.notify_all();
+			}
+			break;
+		}
+	}
+
+	for (auto& job : continuations)
+	{
+		JobSystem::Dispatch(move(job));
+	}
+}
+
+void JobCounter::Wait()
+{
+	while (!IsCompleted())
+	{
+		if (!JobSystem::TryExecuteJob())
+		{
+			JobSystem::Sleep(this);
+		}
+	}
+
+	// Wait thread that decremented to zero releases lock.
+	unique_lock lock(_lock);
+}
+
+void JobSystem::Initialize(size_t numWorkers)
+{
+	if (GState.bRunning)
+	{
+		LogSystem::Log<Warning>(LogCore, L"Job system is already initialized. Abort.");
+		return;
+	}
+
+	if (numWorkers == 0)
+	{
+		numWorkers = max(thread::hardware_concurrency(), 2u) - 1;
+	}
+
+	for (size_t i = 0; i < numWorkers; ++i)
+	{
+		GState.Queues.emplace_back(make_unique<WorkStealingDeque>());
+	}
+
+	GState.bRunning = true;
+	for (size_t i = 0; i < numWorkers; ++i)
+	{
+		GState.Workers.emplace_back([i]() { WorkerMain(i); });
+	}
+
+	LogSystem::Log<Info>(LogCore, L"Job system is initialized with {} workers.", numWorkers);
+}
+
+void JobSystem::Shutdown()
+{
+	if (!GState.bRunning)
+	{
+		return;
+	}
+
+	// Execute remaining jobs on calling thread.
+	while (TryExecuteJob());
+
+	{
+		unique_lock lock(GState.SleepLock);
+		GState.bRunning = false;
+	}
+	GState.Wakeup.notify_all();
+
+	for (auto& worker : GState.Workers)
+	{
+		worker.join();
+	}
+
+	GState.Workers.clear();
+	GState.Queues.clear();
+}
+
+size_t JobSystem::GetNumWorkers()
+{
+	return GState.Workers.size();
+}
+
+bool JobSystem::IsWorkerThread()
+{
+	return GWorkerIndex != NonWorkerIndex;
+}
+
+void JobSystem::Schedule(function<void()> task, JobCounter* counter, JobCounter* prerequisite)
+{
+	if (counter != nullptr)
+	{
+		counter->Increment();
+	}
+
+	Job job = { .Task = move(task), .Counter = counter };
+
+	if (prerequisite != nullptr)
+	{
+		unique_lock lock(prerequisite->_lock);
+		if (!prerequisite->IsCompleted())
+		{
+			// Job will be dispatched when prerequisite is decremented to zero.
+			prerequisite->_continuations.emplace_back(move(job));
+			return;
+		}
+	}
+
+	Dispatch(move(job));
+}
+
+void JobSystem::ParallelFor(size_t count, const function<void(size_t begin, size_t end)>& body, size_t minChunkSize)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	const size_t numParticipants = GetNumWorkers() + 1;
+	minChunkSize = max(minChunkSize, (size_t)1);
+	if (numParticipants == 1 || count <= minChunkSize)
+	{
+		body(0, count);
+		return;
+	}
+
+	atomic<size_t> next = 0;
+	auto process = [&]()
+	{
+		size_t begin = next.load(memory_order_relaxed);
+		while (begin < count)
+		{
+			// Guided scheduling: take part of remaining range proportional to participants.
+			size_t chunk = max(minChunkSize, (count - begin) / (numParticipants * 2));
+			size_t end = min(count, begin + chunk);
+			if (next.compare_exchange_weak(begin, end, memory_order_relaxed))
+			{
+				body(begin, end);
+				begin = next.load(memory_order_relaxed);
+			}
+		}
+	};
+
+	JobCounter counter;
+	const size_t numJobs = min(numParticipants - 1, (count + minChunkSize - 1) / minChunkSize - 1);
+	for (size_t i = 0; i < numJobs; ++i)
+	{
+		Schedule(process, &counter);
+	}
+
+	process();
+	counter.Wait();
+}
+
+bool JobSystem::TryExecuteJob()
+{
+	if (GState.NumPending.load(memory_order_acquire) == 0)
+	{
+		return false;
+	}
+
+	const size_t numQueues = GState.Queues.size();
+	const bool bWorker = IsWorkerThread();
+	const size_t ownIndex = bWorker ? GWorkerIndex : 0;
+
+	// Owner takes latest job for locality, and thief takes oldest job.
+	Job* job = bWorker ? GState.Queues[ownIndex]->Pop() : nullptr;
+	if (job == nullptr)
+	{
+		job = PopShared();
+	}
+
+	for (size_t i = 0; job == nullptr && i < numQueues; ++i)
+	{
+		size_t victim = (ownIndex + i) % numQueues;
+		if (!bWorker || victim != ownIndex)
+		{
+			job = GState.Queues[victim]->Steal();
+		}
+	}
+
+	if (job == nullptr)
+	{
+		return false;
+	}
+
+	GState.NumPending.fetch_sub(1, memory_order_acq_rel);
+	Execute(*job);
+	delete job;
+	return true;
+}
+
+void JobSystem::Dispatch(Job&& job)
+{
+	if (GState.Workers.empty())
+	{
+		// No worker. Execute job on scheduling thread.
+		Execute(job);
+		return;
+	}
+
+	Job* ptr = new Job(move(job));
+	if (IsWorkerThread())
+	{
+		GState.Queues[GWorkerIndex]->Push(ptr);
+	}
+	else
+	{
+		unique_lock lock(GState.Shared.Lock);
+		GState.Shared.Jobs.emplace_back(ptr);
+	}
+
+	GState.NumPending.fetch_add(1, memory_order_acq_rel);
+
+	// Synchronize with sleeping thread that checked pending count before this.
+	{
+		unique_lock lock(GState.SleepLock);
+	}
+	GState.Wakeup.notify_one();
+}
+
+void JobSystem::Execute(Job& job)
+{
+	// Counter is decremented even if job throws, or waiters of counter block forever.
+	ScopeGuard counterGuard([&job]()
+	{
+		if (job.Counter != nullptr)
+		{
+			job.Counter->Decrement();
+		}
+	});
+
+	// Exception can not be propagated from worker thread. It is logged and job is treated as completed.
+	try
+	{
+		job.Task();
+	}
+	catch (const exception& e)
+	{
+		LogSystem::Log<Error>(LogCore, L"Unhandled exception is thrown by job: {}", StringUtils::AsUnicode(e.what()));
+	}
+	catch (...)
+	{
+		LogSystem::Log<Error>(LogCore, L"Unknown exception is thrown by job.");
+	}
+}
+
+void JobSystem::Sleep(JobCounter* counter)
+{
+	// Waiter sleeps with idle workers, and wakes when new job is dispatched or counter is completed.
+	// Sequentially consistent accesses pair with Decrement, so either waiter sees zero or decrementer sees waiter.
+	counter->_numWaiters.fetch_add(1);
+	{
+		unique_lock lock(GState.SleepLock);
+		GState.Wakeup.wait(lock, [counter]() { return counter->_count.load() == 0 || GState.NumPending.load(memory_order_acquire) != 0; });
+	}
+	counter->_numWaiters.fetch_sub(1);
+}
+
+void JobSystem::WorkerMain(size_t workerIndex)
+{
+	GWorkerIndex = workerIndex;
+
+	while (true)
+	{
+		if (TryExecuteJob())
+		{
+			continue;
+		}
+
+		unique_lock lock(GState.SleepLock);
+		GState.Wakeup.wait(lock, []() { return !GState.bRunning || GState.NumPending.load(memory_order_acquire) != 0; });
+
+		if (!GState.bRunning)
+		{
+			break;
+		}
+	}
+
+	GWorkerIndex = NonWorkerIndex;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:JobSystem;
+
+import std.core;
+import std.threading;
+import :PrimitiveTypes;
+
+using namespace std;
+
+export class JobCounter;
+
+/// <summary>
+/// Represents job that executed on worker thread of <see cref="JobSystem"/>.
+/// </summary>
+export struct Job
+{
+	/// <summary>
+	/// The job body.
+	/// </summary>
+	function<void()> Task;
+
+	/// <summary>
+	/// The counter that decremented when job is completed.
+	/// </summary>
+	JobCounter* Counter = nullptr;
+};
+
+/// <summary>
+/// Represents counter of incompleted jobs. Use as fence that wait scheduled jobs, or as prerequisite of other jobs.
+/// </summary>
+export class JobCounter
+{
+	friend class JobSystem;
+
+	atomic<size_t> _count = 0;
+	atomic<size_t> _numWaiters = 0;
+	mutex _lock;
+	vector<Job> _continuations;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="JobCounter"/> instance.
+	/// </summary>
+	JobCounter();
+	JobCounter(const JobCounter&) = delete;
+	~JobCounter();
+
+	/// <summary>
+	/// Get count of incompleted jobs.
+	/// </summary>
+	size_t GetCount() const { return _count.load(memory_order_acquire); }
+
+	/// <summary>
+	/// Indicate all jobs are completed.
+	/// </summary>
+	bool IsCompleted() const { return GetCount() == 0; }
+
+	/// <summary>
+	/// Increment counter. Jobs that scheduled with this counter as prerequisite wait until counter is decremented to zero.
+	/// </summary>
+	/// <param name="count"> The increment. </param>
+	void Increment(size_t count = 1);
+
+	/// <summary>
+	/// Decrement counter. Dependent jobs are scheduled when counter is zero.
+	/// </summary>
+	void Decrement();
+
+	/// <summary>
+	/// Wait until counter is zero. Calling thread executes other jobs while waiting, and sleeps if there is no job to execute.
+	/// Counter can be destroyed safely after this returns.
+	/// </summary>
+	void Wait();
+};
+
+/// <summary>
+/// Provide job scheduling functions on fixed worker pool. Each worker owns lock-free work-stealing deque,
+/// and idle worker steals jobs from other workers. Jobs that scheduled from non-worker threads are queued to shared queue.
+/// </summary>
+export class JobSystem abstract final
+{
+	friend class JobCounter;
+
+public:
+	/// <summary>
+	/// Start worker threads.
+	/// </summary>
+	/// <param name="numWorkers"> The count of worker threads. Use hardware concurrency except calling thread if zero. </param>
+	static void Initialize(size_t numWorkers = 0);
+
+	/// <summary>
+	/// Execute remaining jobs and stop worker threads.
+	/// </summary>
+	static void Shutdown();
+
+	/// <summary>
+	/// Get count of worker threads. Jobs are executed on scheduling thread if there is no worker.
+	/// </summary>
+	static size_t GetNumWorkers();
+
+	/// <summary>
+	/// Indicate calling thread is worker thread.
+	/// </summary>
+	static bool IsWorkerThread();
+
+	/// <summary>
+	/// Schedule job. Exception that thrown by job is logged and job is treated as completed.
+	/// </summary>
+	/// <param name="task"> The job body. </param>
+	/// <param name="counter"> The counter that incremented now and decremented when job is completed. </param>
+	/// <param name="prerequisite"> The counter that job waits until it is zero. </param>
+	static void Schedule(function<void()> task, JobCounter* counter = nullptr, JobCounter* prerequisite = nullptr);
+
+	/// <summary>
+	/// Execute body for range [0, count) across worker threads, and wait it. Calling thread participates.
+	/// Chunk size is adapted to remaining range, so first chunks are large and last chunks balance load.
+	/// </summary>
+	/// <param name="count"> The count of iterations. </param>
+	/// <param name="body"> The body that process range [begin, end). </param>
+	/// <param name="minChunkSize"> The minimum count of iterations of each chunk. </param>
+	static void ParallelFor(size_t count, const function<void(size_t begin, size_t end)>& body, size_t minChunkSize = 1);
+
+	/// <summary>
+	/// Execute single pending job on calling thread.
+	/// </summary>
+	/// <returns> Return false if there is no pending job. </returns>
+	static bool TryExecuteJob();
+
+private:
+	static void Dispatch(Job&& job);
+	static void Execute(Job& job);
+	static void Sleep(JobCounter* counter);
+	static void WorkerMain(size_t workerIndex);
+};
\ No newline at end of file
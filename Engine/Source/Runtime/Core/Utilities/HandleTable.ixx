@@ -0,0 +1,197 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:HandleTable;
+
+import std.core;
+import :PrimitiveTypes;
+
+using namespace std;
+
+/// <summary>
+/// Represents generational handle that refer to item of <see cref="HandleTable"/>.
+/// The default value is never valid.
+/// </summary>
+export struct ObjectHandle
+{
+	uint32 Index = 0;
+	uint32 Generation = 0;
+
+	/// <summary>
+	/// Indicate this handle was issued by any table.
+	/// </summary>
+	inline constexpr bool IsSet() const { return Generation != 0; }
+
+	inline constexpr bool operator ==(const ObjectHandle& rhs) const
+	{
+		return Index == rhs.Index && Generation == rhs.Generation;
+	}
+
+	inline constexpr bool operator !=(const ObjectHandle& rhs) const
+	{
+		return Index != rhs.Index || Generation != rhs.Generation;
+	}
+};
+
+/// <summary>
+/// Represents table that issue generational handles for items.
+/// Items are stored densely, so iterating items is linear and resolving handle is O(1) without hashing.
+/// Handle that refer to removed item is detected as stale.
+/// </summary>
+/// <typeparam name="T"> The type of item. </typeparam>
+export template<class T>
+class HandleTable
+{
+	struct Slot
+	{
+		// Index of dense array if slot is alive, otherwise next free slot index.
+		uint32 DenseIndex = 0;
+		uint32 Generation = 1;
+		bool bAlive = false;
+	};
+
+	static constexpr uint32 InvalidIndex = 0xFFFFFFFF;
+
+	vector<T> _items;
+	vector<uint32> _itemSlots;
+	vector<Slot> _slots;
+	uint32 _freeSlot = InvalidIndex;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="HandleTable"/> instance.
+	/// </summary>
+	HandleTable()
+	{
+	}
+
+	/// <summary>
+	/// Add item to table.
+	/// </summary>
+	/// <param name="item"> The item. </param>
+	/// <returns> The issued handle. </returns>
+	ObjectHandle Add(T item)
+	{
+		uint32 slotIndex = _freeSlot;
+		if (slotIndex != InvalidIndex)
+		{
+			_freeSlot = _slots[slotIndex].DenseIndex;
+		}
+		else
+		{
+			slotIndex = (uint32)_slots.size();
+			_slots.emplace_back();
+		}
+
+		Slot& slot = _slots[slotIndex];
+		slot.DenseIndex = (uint32)_items.size();
+		slot.bAlive = true;
+
+		_items.emplace_back(move(item));
+		_itemSlots.emplace_back(slotIndex);
+
+		return { .Index = slotIndex, .Generation = slot.Generation };
+	}
+
+	/// <summary>
+	/// Remove item that referenced by handle. All handles that refer to the item will be stale.
+	/// </summary>
+	/// <param name="handle"> The handle. </param>
+	/// <returns> Return false if handle is already stale. </returns>
+	bool Remove(const ObjectHandle& handle)
+	{
+		if (!IsValid(handle))
+		{
+			return false;
+		}
+
+		Slot& slot = _slots[handle.Index];
+		const uint32 denseIndex = slot.DenseIndex;
+		const uint32 lastIndex = (uint32)_items.size() - 1;
+
+		// Move last item to removed position for keeping dense array.
+		if (denseIndex != lastIndex)
+		{
+			_items[denseIndex] = move(_items[lastIndex]);
+			_itemSlots[denseIndex] = _itemSlots[lastIndex];
+			_slots[_itemSlots[denseIndex]].DenseIndex = denseIndex;
+		}
+
+		_items.pop_back();
+		_itemSlots.pop_back();
+
+		slot.bAlive = false;
+		slot.DenseIndex = _freeSlot;
+		if (++slot.Generation == 0)
+		{
+			// Generation 0 is reserved for the default handle.
+			slot.Generation = 1;
+		}
+		_freeSlot = handle.Index;
+
+		return true;
+	}
+
+	/// <summary>
+	/// Indicate handle refer to alive item.
+	/// </summary>
+	bool IsValid(const ObjectHandle& handle) const
+	{
+		if (handle.Index >= _slots.size())
+		{
+			return false;
+		}
+
+		const Slot& slot = _slots[handle.Index];
+		return slot.bAlive && slot.Generation == handle.Generation;
+	}
+
+	/// <summary>
+	/// Find item that referenced by handle.
+	/// </summary>
+	/// <returns> The pointer of item. Return nullptr if handle is stale. </returns>
+	T* Find(const ObjectHandle& handle)
+	{
+		return IsValid(handle) ? &_items[_slots[handle.Index].DenseIndex] : nullptr;
+	}
+
+	/// <summary>
+	/// Find item that referenced by handle.
+	/// </summary>
+	/// <returns> The pointer of item. Return nullptr if handle is stale. </returns>
+	const T* Find(const ObjectHandle& handle) const
+	{
+		return IsValid(handle) ? &_items[_slots[handle.Index].DenseIndex] : nullptr;
+	}
+
+	/// <summary>
+	/// Remove all items. All issued handles will be stale.
+	/// </summary>
+	void Clear()
+	{
+		while (!_itemSlots.empty())
+		{
+			const uint32 slotIndex = _itemSlots.back();
+			Remove({ .Index = slotIndex, .Generation = _slots[slotIndex].Generation });
+		}
+	}
+
+	/// <summary>
+	/// Get count of alive items.
+	/// </summary>
+	size_t GetCount() const { return _items.size(); }
+
+	/// <summary>
+	/// Get alive items as contiguous array.
+	/// </summary>
+	span<T> GetItems() { return _items; }
+
+	/// <summary>
+	/// Get alive items as contiguous array.
+	/// </summary>
+	span<T const> GetItems() const { return _items; }
+
+	auto begin() { return _items.begin(); }
+	auto end() { return _items.end(); }
+	auto begin() const { return _items.begin(); }
+	auto end() const { return _items.end(); }
+};
\ No newline at end of file
@@ -0,0 +1,45 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Core:ScopeGuard;
+
+import std.core;
+
+using namespace std;
+
+/// <summary>
+/// Invoke function when guard leaves scope, include leaving by exception.
+/// </summary>
+export template<class TFunction>
+class ScopeGuard
+{
+	TFunction _function;
+	bool _bDismissed = false;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="ScopeGuard"/> instance.
+	/// </summary>
+	/// <param name="function"> The function to invoke when leaves scope. </param>
+	explicit ScopeGuard(TFunction function) : _function(move(function))
+	{
+	}
+
+	ScopeGuard(const ScopeGuard&) = delete;
+	ScopeGuard& operator =(const ScopeGuard&) = delete;
+
+	~ScopeGuard() noexcept
+	{
+		if (!_bDismissed)
+		{
+			_function();
+		}
+	}
+
+	/// <summary>
+	/// Cancel invoking function.
+	/// </summary>
+	void Dismiss()
+	{
+		_bDismissed = true;
+	}
+};
\ No newline at end of file
@@ -23,7 +23,7 @@ wstring StringUtils::AsUnicode(const string& multibyte, uint32 codePage)
 	int32 length = MultiByteToWideChar(codePage, 0, multibyte.c_str(), (int32)multibyte.length(), nullptr, 0);
 	if (length == 0)
 	{
-		LogSystem::Log(LogCore, Error, L"Cannot convert multibyte string to unicode string with CodePage[{}].", codePage);
+		LogSystem::Log<Error>(LogCore, L"Cannot convert multibyte string to unicode string with CodePage[{}].", codePage);
 		return L"<ERROR_STRING_CONVERTING>";
 	}
 
@@ -39,7 +39,7 @@ string StringUtils::AsMultibyte(const wstring& unicode, uint32 codePage)
 	int32 length = WideCharToMultiByte(codePage, 0, unicode.c_str(), (int32)unicode.length(), nullptr, 0, nullptr, nullptr);
 	if (length == 0)
 	{
-		LogSystem::Log(LogCore, Error, L"Cannot convert unicode string to multibyte string with CodePage[{}].", codePage);
+		LogSystem::Log<Error>(LogCore, L"Cannot convert unicode string to multibyte string with CodePage[{}].", codePage);
 		return "<ERROR_STRING_CONVERTING>";
 	}
 
@@ -14,16 +14,19 @@ APlayerCameraManager::APlayerCameraManager()
 
 MinimalViewInfo APlayerCameraManager::UpdateCamera(duration<float> elapsedTime) const
 {
-	if (_cachedBindCamera == nullptr)
+	World* const world = GetWorld();
+	CameraComponent* camera = world != nullptr ? world->ResolveComponent<CameraComponent>(_cachedBindCamera) : nullptr;
+	if (camera == nullptr)
 	{
-		LogSystem::Log(LogCamera, Error, L"There is no cached camera component. Please call CachePlayerCamera with PlayerController instance to binding current camera component that owned by possessed pawn.");
+		LogSystem::Log<Error>(LogCamera, L"There is no cached camera component. Please call CachePlayerCamera with PlayerController instance to binding current camera component that owned by possessed pawn.");
 		return MinimalViewInfo();
 	}
 
-	return _cachedBindCamera->GetViewInfo(elapsedTime);
+	return camera->GetViewInfo(elapsedTime);
 }
 
 void APlayerCameraManager::CachePlayerCamera(APlayerController* controller)
 {
-	_cachedBindCamera = controller->FindPlayerCameraComponent();
+	CameraComponent* camera = controller->FindPlayerCameraComponent();
+	_cachedBindCamera = camera != nullptr ? camera->GetHandle() : ObjectHandle();
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 export module SC.Runtime.Game:APlayerCameraManager;
 
 import std.core;
+import SC.Runtime.Core;
 import :AActor;
 import :MinimalViewInfo;
 
@@ -17,7 +18,7 @@ public:
 	using Super = AActor;
 
 private:
-	CameraComponent* _cachedBindCamera = nullptr;
+	ObjectHandle _cachedBindCamera;
 
 public:
 	APlayerCameraManager();
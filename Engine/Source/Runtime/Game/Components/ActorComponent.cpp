@@ -13,14 +13,14 @@ void ActorComponent::ComponentTickFunction::ExecuteTick(duration<float> elapsedT
 {
 	if (_target == nullptr)
 	{
-		LogSystem::Log(LogTicking, Error, L"Target is nullptr.");
+		LogSystem::Log<Error>(LogTicking, L"Target is nullptr.");
 		return;
 	}
 
 	AActor* const owner = _target->GetOwner();
 	if (owner == nullptr)
 	{
-		LogSystem::Log(LogTicking, Error, L"Target have not any owner actor.");
+		LogSystem::Log<Error>(LogTicking, L"Target have not any owner actor.");
 		return;
 	}
 
@@ -31,6 +31,11 @@ void ActorComponent::ComponentTickFunction::ExecuteTick(duration<float> elapsedT
 	}
 }
 
+wstring ActorComponent::ComponentTickFunction::ToString(wstring_view formatArgs) const
+{
+	return format(L"{}.PrimaryComponentTick", _target != nullptr ? _target->GetName() : L"nullptr");
+}
+
 ActorComponent::ActorComponent() : Super()
 	, PrimaryComponentTick(this)
 {
@@ -58,5 +63,26 @@ void ActorComponent::SetActive(bool bActive)
 
 void ActorComponent::RegisterComponentWithWorld(World* world)
 {
+	if (_world != nullptr)
+	{
+		LogSystem::Log<Verbose>(LogComponent, L"Component is already registered with world. Abort.");
+		return;
+	}
+
+	_world = world;
+	_handle = world->RegisterComponent(this);
 	world->RegisterTickFunction(&PrimaryComponentTick);
+}
+
+void ActorComponent::UnregisterComponentWithWorld()
+{
+	if (_world == nullptr)
+	{
+		return;
+	}
+
+	_world->UnregisterTickFunction(&PrimaryComponentTick);
+	_world->UnregisterComponent(this);
+	_world = nullptr;
+	_handle = {};
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 export module SC.Runtime.Game:ActorComponent;
 
 import std.core;
+import SC.Runtime.Core;
 import :GameObject;
 import :TickFunction;
 
@@ -50,6 +51,9 @@ public:
 
 		/// <inheritdoc/>
 		virtual void ExecuteTick(duration<float> elapsedTime) override;
+
+		/// <inheritdoc/>
+		virtual wstring ToString(wstring_view formatArgs = L"") const override;
 	};
 
 protected:
@@ -59,6 +63,8 @@ private:
 	uint8 _bActive : 1 = true;
 	uint8 _bHasBegunPlay : 1 = false;
 	AActor* _owner = nullptr;
+	World* _world = nullptr;
+	ObjectHandle _handle;
 
 public:
 	ActorComponent();
@@ -77,5 +83,16 @@ public:
 	MulticastEvent<ActorComponent, void()> Activated;
 	MulticastEvent<ActorComponent, void()> Inactivated;
 
+	/// <summary>
+	/// Get world that component is registered.
+	/// </summary>
+	inline World* GetWorld() const { return _world; }
+
+	/// <summary>
+	/// Get handle that issued by world at registered. Keep handle instead of pointer to detect destroyed component.
+	/// </summary>
+	inline ObjectHandle GetHandle() const { return _handle; }
+
 	void RegisterComponentWithWorld(World* world);
+	void UnregisterComponentWithWorld();
 };
\ No newline at end of file
@@ -42,7 +42,7 @@ void SceneComponent::UpdateComponentToWorld()
 
 Transform SceneComponent::GetSocketTransform(const wstring& socketName, EComponentTransformSpace space) const
 {
-	LogSystem::Log(LogSceneComponent, Error, L"SceneComponent::GetSocketName() called. SceneComponent have not any sockets. Use override this function and provide correct socket transform.");
+	LogSystem::Log<Error>(LogSceneComponent, L"SceneComponent::GetSocketName() called. SceneComponent have not any sockets. Use override this function and provide correct socket transform.");
 
 	switch (space)
 	{
@@ -101,13 +101,13 @@ void SceneComponent::AttachToSocket(SceneComponent* attachTo, const wstring& soc
 {
 	if (attachTo == nullptr)
 	{
-		LogSystem::Log(LogSceneComponent, Warning, L"attachTo is nullptr. First argument of AttachToComponent function must not be nullptr. Abort.");
+		LogSystem::Log<Warning>(LogSceneComponent, L"attachTo is nullptr. First argument of AttachToComponent function must not be nullptr. Abort.");
 		return;
 	}
 
 	if (_attachment.AttachmentRoot == attachTo && _attachment.SocketName == socketName)
 	{
-		LogSystem::Log(LogSceneComponent, Verbose, L"Component is already attach to desired target. Abort.");
+		LogSystem::Log<Verbose>(LogSceneComponent, L"Component is already attach to desired target. Abort.");
 		return;
 	}
 
@@ -127,14 +127,14 @@ void SceneComponent::DetachFromComponent()
 {
 	if (_attachment.AttachmentRoot == nullptr)
 	{
-		LogSystem::Log(LogSceneComponent, Verbose, L"Component is already detached from any components. Abort.");
+		LogSystem::Log<Verbose>(LogSceneComponent, L"Component is already detached from any components. Abort.");
 		return;
 	}
 
 	auto it = find(_childComponents.begin(), _childComponents.end(), this);
 	if (it == _childComponents.end())
 	{
-		LogSystem::Log(LogSceneComponent, Error, L"Cannot found this component from child component list of parent component.");
+		LogSystem::Log<Error>(LogSceneComponent, L"Cannot found this component from child component list of parent component.");
 	}
 	else
 	{
@@ -230,7 +230,7 @@ void SceneComponent::UpdateWorldTransform()
 {
 	if (HasBegunPlay() && _mobility != EComponentMobility::Movable)
 	{
-		LogSystem::Log(LogSceneComponent, Error, L"SceneComponent has been try move but it is not movable mobility.");
+		LogSystem::Log<Error>(LogSceneComponent, L"SceneComponent has been try move but it is not movable mobility.");
 		return;
 	}
 
@@ -8,6 +8,7 @@ export import :GameInstance;
 export import :IFrameworkView;
 export import :Transform;
 export import :GameEngine;
+export import :RenderThread;
 export import :SubclassOf;
 
 // GameFramework
@@ -21,6 +22,7 @@ export import :APawn;
 export import :TickingGroup;
 export import :TickFunction;
 export import :TickScheduler;
+export import :TickGraph;
 
 // Level
 export import :Level;
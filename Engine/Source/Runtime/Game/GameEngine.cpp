@@ -4,53 +4,143 @@ import SC.Runtime.Game;
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
 import std.core;
+import std.filesystem;
 
 using enum ELogVerbosity;
 
 using namespace std;
 using namespace std::chrono;
 
-GameEngine::GameEngine(bool bDebug) : Super()
+GameEngine::GameEngine(bool bDebug, ERHIDeviceType deviceType) : Super()
 	, _bDebug(bDebug)
+	, _deviceType(deviceType)
 {
 }
 
 GameEngine::~GameEngine()
 {
+	if (_renderThread != nullptr)
+	{
+		_renderThread->Shutdown();
+	}
+
+	JobSystem::Shutdown();
+	LogSystem::SetAsyncLogging(false);
 }
 
 void GameEngine::InitEngine(GameInstance* gameInstance)
 {
-	LogSystem::Log(LogEngine, Info, L"Initialize engine.");
+	LogSystem::SetAsyncLogging(true);
+	LogSystem::Log<Info>(LogEngine, L"Initialize engine.");
+	JobSystem::Initialize();
 
 	IFrameworkView* frameworkView = gameInstance->GetFrameworkView();
 
-	LogSystem::Log(LogEngine, Info, L"Initialize RHI subsystems.");
+	LogSystem::Log<Info>(LogEngine, L"Initialize RHI subsystems.");
 	_gameInstance = gameInstance;
-	_device = CreateSubobject<RHIDevice>(_bDebug);
+	_device = CreateSubobject<RHIDevice>(_bDebug, _deviceType);
 	_primaryQueue = _device->GetPrimaryQueue();
 	_frameworkViewChain = CreateSubobject<RHISwapChain>(_device, frameworkView, _primaryQueue);
-	_deviceContext = CreateSubobject<RHIDeviceContext>(_device);
+	_deviceContextPool = CreateSubobject<RHIDeviceContextPool>(_device, NumFramesInFlight);
+	for (int32 i = 0; i < NumFramesInFlight; ++i)
+	{
+		_deviceContextPool->Acquire(i, 1);
+	}
+	_shaderCompiler = CreateSubobject<RHIShaderCompilerD3D>();
+	_shaderBytecodeCache = CreateSubobject<RHIShaderBytecodeCache>(_shaderCompiler, ShaderCacheDirectory);
 	_colorVertexFactory = CreateSubobject<ColorVertexFactory>(_device);
 	_colorShader = CreateSubobject<ColorShader>(_device);
+	_colorShader->RegisterSources(_shaderBytecodeCache, ShaderSourceDirectory);
+
+	// Registered shader sources are compiled on worker threads while pipeline state cache is loaded.
+	_shaderBytecodeCache->CompileAll();
+	RHIPipelineStateCache* pipelineStateCache = _device->GetPipelineStateCache();
+	pipelineStateCache->Load(PipelineStateCacheFile);
 	_colorShader->Compile(_colorVertexFactory);
+
+	RHIShaderBytecodeCacheStatistics shaderStats = _shaderBytecodeCache->GetStatistics();
+	LogSystem::Log<Info>(LogEngine, L"Shader bytecodes are ready. Compiled: {} ({:.3f}ms), Failed: {}, Disk hits: {}, Memory hits: {}.", shaderStats.NumCompiled, shaderStats.CompileTime.count() * 1000.0f, shaderStats.NumFailed, shaderStats.NumDiskHits, shaderStats.NumMemoryHits);
+
+	RHIPipelineStateCacheStatistics cacheStats = pipelineStateCache->GetStatistics();
+	LogSystem::Log<Info>(LogEngine, L"Pipeline states are created in {:.3f}ms. Misses: {}, Disk hits: {}, Memory hits: {}.", cacheStats.CreationTime.count() * 1000.0f, cacheStats.NumMisses, cacheStats.NumDiskHits, cacheStats.NumMemoryHits);
+	pipelineStateCache->Save(PipelineStateCacheFile);
 	_rtv = CreateSubobject<RHIRenderTargetView>(_device, 3);
+	_renderGraph = CreateSubobject<RenderGraph>(_device);
+
+	LogSystem::Log<Info>(LogEngine, L"Start render thread.");
+	_renderThread = CreateSubobject<RenderThread>(_primaryQueue, NumFramesInFlight, [this](const FramePacket& packet, int32 frameIndex)
+	{
+		return RenderTick(packet, frameIndex);
+	});
+
+	// Null device have not window surface. Allocate back buffers with default size.
+	if (_device->IsNullDevice())
+	{
+		ResizedApp(800, 600);
+	}
+
+	if (frameworkView != nullptr)
+	{
+		LogSystem::Log<Info>(LogEngine, L"Register engine tick.");
+		frameworkView->Idle.AddMember(this, &GameEngine::TickEngine);
+		frameworkView->Size.AddMember(this, &GameEngine::ResizedApp);
+	}
+}
+
+void GameEngine::SetPendingKillTimeBudget(optional<duration<float>> timeBudget)
+{
+	_pendingKillTimeBudget = timeBudget;
+}
+
+void GameEngine::SetFixedTimeStep(optional<duration<float>> timeStep)
+{
+	if (timeStep.has_value() && timeStep->count() <= 0)
+	{
+		LogSystem::Log<Error>(LogEngine, L"Fixed time step should be greater than zero. Abort.");
+		return;
+	}
 
-	LogSystem::Log(LogEngine, Info, L"Register engine tick.");
-	frameworkView->Idle += [this]() { TickEngine(); };
-	frameworkView->Size += [this](int32 width, int32 height) { ResizedApp(width, height); };
+	_fixedTimeStep = timeStep;
+	_fixedTimeAccumulator = 0ns;
+	_interpolationAlpha = 1.0f;
+}
 
-	RegisterRHIGarbageCollector();
+void GameEngine::SetMaxSubsteps(int32 maxSubsteps)
+{
+	_maxSubsteps = max(maxSubsteps, 1);
 }
 
-void GameEngine::RegisterRHIGarbageCollector()
+int32 GameEngine::StepSimulation(duration<float> elapsedTime)
 {
-	auto gc = [this]()
+	if (!_fixedTimeStep.has_value())
 	{
-		int32 count = _primaryQueue->Collect();
-		LogSystem::Log(LogEngine, Verbose, L"Collect {} RHI garbages.", count);
-	};
-	_scheduler.AddSchedule({ .Task = gc, .Delay = 10s, .InitDelay = 10s });
+		GameTick(elapsedTime);
+		_interpolationAlpha = 1.0f;
+		return 1;
+	}
+
+	const duration<float> timeStep = _fixedTimeStep.value();
+	_fixedTimeAccumulator += elapsedTime;
+
+	int32 numSteps = 0;
+	while (_fixedTimeAccumulator >= timeStep && numSteps < _maxSubsteps)
+	{
+		GameTick(timeStep);
+		_fixedTimeAccumulator -= timeStep;
+		++numSteps;
+	}
+
+	// Drop time that could not be simulated in this frame, instead of making next frame longer.
+	if (_fixedTimeAccumulator >= timeStep)
+	{
+		duration<float> remaining = duration<float>(fmod(_fixedTimeAccumulator.count(), timeStep.count()));
+		duration<float> dropped = _fixedTimeAccumulator - remaining;
+		LogSystem::Log<Verbose>(LogEngine, L"Game tick is behind. Drop {:.3f}ms of simulation time.", dropped.count() * 1000.0f);
+		_fixedTimeAccumulator = remaining;
+	}
+
+	_interpolationAlpha = _fixedTimeAccumulator / timeStep;
+	return numSteps;
 }
 
 void GameEngine::TickEngine()
@@ -63,8 +153,23 @@ void GameEngine::TickEngine()
 	}
 	_prev = now;
 
-	GameTick(deltaSeconds);
-	RenderTick(deltaSeconds);
+	StepSimulation(deltaSeconds);
+
+	// Render thread renders this frame while game thread proceeds next frame.
+	_renderThread->EnqueueFrame(
+	{
+		.FrameNumber = _frameNumber++,
+		.UploadMarker = _device->GetUploadRingBuffer()->CloseFrame(),
+		.ElapsedTime = deltaSeconds,
+		.InterpolationAlpha = _interpolationAlpha,
+		.ViewportWidth = _vpWidth,
+		.ViewportHeight = _vpHeight
+	});
+
+	FlushPendingKills();
+
+	// Garbages are released as soon as GPU completes frames that used them.
+	_primaryQueue->Collect(RHIGarbageTimeBudget);
 }
 
 void GameEngine::ResizedApp(int32 width, int32 height)
@@ -74,9 +179,17 @@ void GameEngine::ResizedApp(int32 width, int32 height)
 		return;
 	}
 
-	// On the framework view is resized, wait all graphics commands for
+	// On the framework view is resized, wait frames that use back buffers for
 	// synchronize and cleanup resource lock states.
-	_primaryQueue->WaitLastSignal();
+	if (_renderThread != nullptr)
+	{
+		_renderThread->Flush();
+	}
+	else
+	{
+		_primaryQueue->WaitLastSignal();
+	}
+	_primaryQueue->Collect();
 
 	_frameworkViewChain->ResizeBuffers(width, height);
 
@@ -89,25 +202,29 @@ void GameEngine::ResizedApp(int32 width, int32 height)
 	_vpWidth = width;
 	_vpHeight = height;
 
-	LogSystem::Log(LogEngine, Info, L"Application resized to {}x{}.", width, height);
+	LogSystem::Log<Info>(LogEngine, L"Application resized to {}x{}.", width, height);
 }
 
 void GameEngine::GameTick(duration<float> elapsedTime)
 {
 	_scheduler.Tick(elapsedTime);
-	_gameInstance->Tick(elapsedTime);
+	if (_gameInstance != nullptr)
+	{
+		_gameInstance->Tick(elapsedTime);
+	}
 }
 
-void GameEngine::RenderTick(duration<float> elapsedTime)
+uint64 GameEngine::RenderTick(const FramePacket& packet, int32 frameIndex)
 {
 	int32 bufferIdx = _frameworkViewChain->GetCurrentBackBufferIndex();
+	RHIDeviceContext* deviceContext = _deviceContextPool->Acquire(frameIndex, 1)[0];
 
 	RHIViewport vp =
 	{
 		.TopLeftX = 0,
 		.TopLeftY = 0,
-		.Width = (float)_vpWidth,
-		.Height = (float)_vpHeight,
+		.Width = (float)packet.ViewportWidth,
+		.Height = (float)packet.ViewportHeight,
 		.MinDepth = 0,
 		.MaxDepth = 1.0f
 	};
@@ -116,39 +233,51 @@ void GameEngine::RenderTick(duration<float> elapsedTime)
 	{
 		.Left = 0,
 		.Top = 0,
-		.Right = _vpWidth,
-		.Bottom = _vpHeight
+		.Right = packet.ViewportWidth,
+		.Bottom = packet.ViewportHeight
 	};
 
-	RHITransitionBarrier barrierBegin =
+	// Back buffer is imported to render graph, and transitioned to present state after all passes.
+	_renderGraph->Reset();
+	RenderGraphResourceHandle backBuffer = _renderGraph->ImportResource(L"BackBuffer", _frameworkViewChain->GetBuffer(bufferIdx), ERHIResourceStates::Present);
+	_renderGraph->AddPass(L"Scene", [&](RenderGraphBuilder& builder)
 	{
-		.Resource = _frameworkViewChain->GetBuffer(bufferIdx),
-		.StateBefore = ERHIResourceStates::Present,
-		.StateAfter = ERHIResourceStates::RenderTarget
-	};
-	RHITransitionBarrier barrierEnd =
+		builder.Write(backBuffer, ERHIResourceStates::RenderTarget);
+	},
+	[&](RHIDeviceContext* context, const RenderGraph&)
 	{
-		.Resource = _frameworkViewChain->GetBuffer(bufferIdx),
-		.StateBefore = ERHIResourceStates::RenderTarget,
-		.StateAfter = ERHIResourceStates::Present
-	};
+		context->OMSetRenderTargets(_rtv, bufferIdx, 1);
+		context->ClearRenderTargetView(_rtv, bufferIdx, NamedColors::Transparent);
+		context->RSSetScissorRects(1, &sc);
+		context->RSSetViewports(1, &vp);
+		context->SetGraphicsShader(_colorShader);
+		context->IASetPrimitiveTopology(ERHIPrimitiveTopology::TriangleStrip);
+		//context->IASetVertexBuffers(0, 1, &_vbv);
+		context->DrawInstanced(3, 1);
+	});
 
-	_deviceContext->Begin();
-	_deviceContext->TransitionBarrier(1, &barrierBegin);
-	_deviceContext->OMSetRenderTargets(_rtv, bufferIdx, 1);
-	_deviceContext->ClearRenderTargetView(_rtv, bufferIdx, NamedColors::Transparent);
-	_deviceContext->RSSetScissorRects(1, &sc);
-	_deviceContext->RSSetViewports(1, &vp);
-	_deviceContext->SetGraphicsShader(_colorShader);
-	_deviceContext->IASetPrimitiveTopology(ERHIPrimitiveTopology::TriangleStrip);
-	//_deviceContext->IASetVertexBuffers(0, 1, &_vbv);
-	_deviceContext->DrawInstanced(3, 1);
-	_deviceContext->TransitionBarrier(1, &barrierEnd);
-	_deviceContext->End();
-
-	_primaryQueue->ExecuteDeviceContext(_deviceContext);
+	deviceContext->Begin();
+	_renderGraph->Compile();
+	_renderGraph->Execute(deviceContext);
+	deviceContext->End();
 
+	_primaryQueue->ExecuteDeviceContext(deviceContext);
+
+	// Do not wait GPU here. Render thread waits fence value of this frame before reusing frame slot.
 	_frameworkViewChain->Present();
-	_primaryQueue->Signal();
-	_primaryQueue->WaitLastSignal();
+
+	uint64 fenceValue = _primaryQueue->Signal();
+	_device->GetUploadRingBuffer()->RetireFrame(packet.UploadMarker, fenceValue);
+	_device->GetDescriptorAllocator()->RetireFrame(fenceValue);
+	_renderGraph->RetireFrame(fenceValue);
+	return fenceValue;
+}
+
+void GameEngine::FlushPendingKills()
+{
+	PendingKillFlushStats stats = PendingKillQueue::Flush(_pendingKillTimeBudget);
+	if (stats.NumDestroyed != 0)
+	{
+		LogSystem::Log<Verbose>(LogEngine, L"Destroy {} pending kill objects in {:.3f}ms. {} objects remaining.", stats.NumDestroyed, stats.Elapsed.count() * 1000.0f, stats.NumRemaining);
+	}
 }
\ No newline at end of file
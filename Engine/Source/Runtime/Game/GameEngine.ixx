@@ -6,6 +6,7 @@ import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
 import SC.Runtime.Game.Shaders;
 import :TickScheduler;
+import :RenderThread;
 import std.core;
 
 export class GameInstance;
@@ -21,31 +22,69 @@ export class GameEngine : virtual public Object
 public:
 	using Super = Object;
 
+	/// <summary>
+	/// The count of frames that can be in flight. Each frame uses own back buffer and device contexts.
+	/// </summary>
+	static constexpr int32 NumFramesInFlight = 3;
+
+	/// <summary>
+	/// The file path of pipeline state cache.
+	/// </summary>
+	static constexpr wstring_view PipelineStateCacheFile = L"PipelineStateCache.bin";
+
+	/// <summary>
+	/// The directory path of shader bytecode cache.
+	/// </summary>
+	static constexpr wstring_view ShaderCacheDirectory = L"ShaderCache";
+
+	/// <summary>
+	/// The directory path of shader sources that compiled at runtime.
+	/// </summary>
+	static constexpr wstring_view ShaderSourceDirectory = L"Shaders";
+
+	/// <summary>
+	/// The time budget of collecting RHI garbages per frame.
+	/// </summary>
+	static constexpr duration<float> RHIGarbageTimeBudget = 1ms;
+
 private:
 	const uint8 _bDebug : 1;
+	const ERHIDeviceType _deviceType;
 	
 	GameInstance* _gameInstance = nullptr;
 	RHIDevice* _device = nullptr;
 	RHICommandQueue* _primaryQueue = nullptr;
 	RHISwapChain* _frameworkViewChain = nullptr;
-	RHIDeviceContext* _deviceContext = nullptr;
+	RHIDeviceContextPool* _deviceContextPool = nullptr;
+	RHIShaderCompilerD3D* _shaderCompiler = nullptr;
+	RHIShaderBytecodeCache* _shaderBytecodeCache = nullptr;
 	ColorVertexFactory* _colorVertexFactory = nullptr;
 	ColorShader* _colorShader = nullptr;
 	RHIRenderTargetView* _rtv = nullptr;
+	RenderGraph* _renderGraph = nullptr;
 
 	int32 _vpWidth = 0;
 	int32 _vpHeight = 0;
 
 	TickScheduler _scheduler;
+	RenderThread* _renderThread = nullptr;
+	uint64 _frameNumber = 0;
 
 	optional<steady_clock::time_point> _prev;
+	optional<duration<float>> _pendingKillTimeBudget;
+
+	optional<duration<float>> _fixedTimeStep;
+	duration<float> _fixedTimeAccumulator = 0ns;
+	int32 _maxSubsteps = 5;
+	float _interpolationAlpha = 1.0f;
 
 public:
 	/// <summary>
 	/// Initialize new <see cref="GameEngine"/> instance.
 	/// <summary>
 	/// <param name="bDebug"/> Make application state to debugging. </param>
-	GameEngine(bool bDebug);
+	/// <param name="deviceType"/> The backend of render device. </param>
+	GameEngine(bool bDebug, ERHIDeviceType deviceType = ERHIDeviceType::D3D12);
 	~GameEngine() override;
 
 	/// <summary>
@@ -54,12 +93,52 @@ public:
 	/// <param name="gameInstance"> The owner game instance. </param>
 	virtual void InitEngine(GameInstance* gameInstance);
 
-private:
-	void RegisterRHIGarbageCollector();
+	/// <summary>
+	/// Set time budget of destroying pending kill objects per frame. Remaining objects are destroyed on next frame.
+	/// </summary>
+	/// <param name="timeBudget"> The time budget. nullopt to destroy all objects in single frame. </param>
+	void SetPendingKillTimeBudget(optional<duration<float>> timeBudget);
+
+	/// <summary>
+	/// Set fixed time step of game tick. Game tick is executed with fixed time step zero or more times per frame,
+	/// and render tick interpolates between last two game ticks with interpolation alpha.
+	/// </summary>
+	/// <param name="timeStep"> The fixed time step. nullopt to execute game tick once per frame with frame elapsed time. </param>
+	void SetFixedTimeStep(optional<duration<float>> timeStep);
+
+	/// <summary>
+	/// Set maximum count of fixed game ticks per frame. Time that exceed the count is dropped, to bound worst-case cost of frame.
+	/// </summary>
+	/// <param name="maxSubsteps"> The maximum count. </param>
+	void SetMaxSubsteps(int32 maxSubsteps);
+
+	/// <summary>
+	/// Get interpolation alpha between previous and current game tick, that is 1 if fixed time step is not used.
+	/// </summary>
+	inline float GetInterpolationAlpha() const { return _interpolationAlpha; }
+
+	/// <summary>
+	/// Get shader bytecode cache. Shaders that register source to cache on construction are compiled in parallel before pipeline states are created.
+	/// </summary>
+	inline RHIShaderBytecodeCache* GetShaderBytecodeCache() const { return _shaderBytecodeCache; }
+
+	/// <summary>
+	/// Advance game simulation with frame elapsed time, without rendering. It can be used to run engine headless.
+	/// </summary>
+	/// <param name="elapsedTime"> The frame elapsed time. </param>
+	/// <returns> The count of executed game ticks. </returns>
+	int32 StepSimulation(duration<float> elapsedTime);
+
+	/// <summary>
+	/// Proceed single frame. Called on idle of framework view, or called by host directly if engine runs headless.
+	/// </summary>
 	void TickEngine();
+
+private:
 	void ResizedApp(int32 width, int32 height);
 
 private:
 	void GameTick(duration<float> elapsedTime);
-	void RenderTick(duration<float> elapsedTime);
+	uint64 RenderTick(const FramePacket& packet, int32 frameIndex);
+	void FlushPendingKills();
 };
\ No newline at end of file
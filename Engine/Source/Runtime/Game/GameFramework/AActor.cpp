@@ -13,7 +13,7 @@ void AActor::ActorTickFunction::ExecuteTick(duration<float> elapsedTime)
 {
 	if (_target == nullptr)
 	{
-		LogSystem::Log(LogTicking, Error, L"Target is nullptr.");
+		LogSystem::Log<Error>(LogTicking, L"Target is nullptr.");
 		return;
 	}
 
@@ -23,6 +23,11 @@ void AActor::ActorTickFunction::ExecuteTick(duration<float> elapsedTime)
 	}
 }
 
+wstring AActor::ActorTickFunction::ToString(wstring_view formatArgs) const
+{
+	return format(L"{}.PrimaryActorTick", _target != nullptr ? _target->GetName() : L"nullptr");
+}
+
 AActor::AActor() : Super()
 	, PrimaryActorTick(this)
 {
@@ -56,7 +61,8 @@ vector<ActorComponent*> AActor::GetOwnedComponents() const
 		cnt += subset.second.size();
 	}
 
-	vector<ActorComponent*> cps(cnt);
+	vector<ActorComponent*> cps;
+	cps.reserve(cnt);
 	for (auto& subset : _components)
 	{
 		cps.insert(cps.end(), subset.second.begin(), subset.second.end());
@@ -65,19 +71,31 @@ vector<ActorComponent*> AActor::GetOwnedComponents() const
 	return cps;
 }
 
-ActorComponent* AActor::GetComponentByClass(const type_info& type) const
+ActorComponent* AActor::GetComponentByClass(const ObjectClass* type) const
 {
 	// Find component from actor components.
-	if (auto it = _components.find(type.hash_code()); it != _components.end())
+	if (auto it = _components.find(type->GetHashCode()); it != _components.end() && !it->second.empty())
 	{
 		return (*it->second.begin());
 	}
 
+	// Find component that instance of derived class.
+	for (auto& subset : _components)
+	{
+		for (auto& component : subset.second)
+		{
+			if (component->IsA(type))
+			{
+				return component;
+			}
+		}
+	}
+
 	// Else, find component from scene components.
 	SceneComponent* item = nullptr;
-	ForEachSceneComponents([&item, &type](SceneComponent* component)
+	ForEachSceneComponents([&item, type](SceneComponent* component)
 	{
-		if (typeid(*component).hash_code() == type.hash_code())
+		if (component->IsA(type))
 		{
 			item = component;
 			return true;
@@ -86,20 +104,20 @@ ActorComponent* AActor::GetComponentByClass(const type_info& type) const
 		return false;
 	});
 
-	return nullptr;
+	return item;
 }
 
 void AActor::SetRootComponent(SceneComponent* scene)
 {
 	if (scene == nullptr)
 	{
-		LogSystem::Log(LogComponent, Error, L"The root component could not be nullptr.");
+		LogSystem::Log<Error>(LogComponent, L"The root component could not be nullptr.");
 		return;
 	}
 
 	if (_rootComponent == nullptr)
 	{
-		LogSystem::Log(LogComponent, Verbose, L"The root component is not empty. Instance will be dangling.");
+		LogSystem::Log<Verbose>(LogComponent, L"The root component is not empty. Instance will be dangling.");
 	}
 
 	_rootComponent = scene;
@@ -115,6 +133,24 @@ SceneComponent* AActor::GetRootComponent() const
 	return _rootComponent;
 }
 
+void AActor::RegisterActorWithWorld(World* world, const ObjectHandle& handle)
+{
+	_world = world;
+	_handle = handle;
+	_world->RegisterTickFunction(&PrimaryActorTick);
+}
+
+void AActor::UnregisterActorWithWorld()
+{
+	if (_world != nullptr)
+	{
+		_world->UnregisterTickFunction(&PrimaryActorTick);
+	}
+
+	_world = nullptr;
+	_handle = {};
+}
+
 void AActor::ForEachSceneComponents(function<bool(SceneComponent*)> body) const
 {
 	if (_rootComponent == nullptr)
@@ -11,6 +11,8 @@ import :SceneComponent;
 using namespace std;
 using namespace std::chrono;
 
+export class World;
+
 /// <summary>
 /// Represents actor that, spawn to world and interaction with other actors.
 /// </summary>
@@ -49,6 +51,9 @@ public:
 
 		/// <inheritdoc/>
 		virtual void ExecuteTick(duration<float> elapsedTime) override;
+
+		/// <inheritdoc/>
+		virtual wstring ToString(wstring_view formatArgs = L"") const override;
 	};
 
 protected:
@@ -60,6 +65,8 @@ protected:
 private:
 	uint8 _bActive : 1 = true;
 	uint8 _bHasBegunPlay : 1 = false;
+	World* _world = nullptr;
+	ObjectHandle _handle;
 
 public:
 	/// <summary>
@@ -67,6 +74,16 @@ public:
 	/// </summary>
 	AActor();
 
+	/// <summary>
+	/// Get world that actor is spawned.
+	/// </summary>
+	inline World* GetWorld() const { return _world; }
+
+	/// <summary>
+	/// Get handle that issued by world at spawned. Keep handle instead of pointer to detect destroyed actor.
+	/// </summary>
+	inline ObjectHandle GetHandle() const { return _handle; }
+
 	/// <summary>
 	/// Update frame tick.
 	/// </summary>
@@ -85,11 +102,11 @@ private:
 
 public:
 	vector<ActorComponent*> GetOwnedComponents() const;
-	ActorComponent* GetComponentByClass(const type_info& type) const;
+	ActorComponent* GetComponentByClass(const ObjectClass* type) const;
 	template<derived_from<ActorComponent> T>
 	T* GetComponentAs() const
 	{
-		return dynamic_cast<T*>(GetComponentByClass(typeid(T)));
+		return static_cast<T*>(GetComponentByClass(ObjectClass::StaticClass<T>()));
 	}
 
 private:
@@ -118,9 +135,9 @@ public:
 		while (!hierarchy.empty())
 		{
 			SceneComponent* top = hierarchy.front();
-			if (typeid(top).hash_code() == typeid(T).hash_code())
+			if (top->IsA<T>())
 			{
-				if (body(top))
+				if (body(static_cast<T*>(top)))
 				{
 					break;
 				}
@@ -137,4 +154,8 @@ public:
 	}
 
 	void ForEachSceneComponents(function<bool(SceneComponent*)> body) const;
+
+public /*internal*/:
+	void RegisterActorWithWorld(World* world, const ObjectHandle& handle);
+	void UnregisterActorWithWorld();
 };
\ No newline at end of file
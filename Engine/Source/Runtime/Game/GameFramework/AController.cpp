@@ -16,7 +16,7 @@ void AController::Possess(APawn* pawn)
 {
 	if (_possessedPawn != nullptr)
 	{
-		LogSystem::Log(LogController, Error, L"The controller already possessed to pawn[{}]. Abort.", _possessedPawn->GetName());
+		LogSystem::Log<Error>(LogController, L"The controller already possessed to pawn[{}]. Abort.", _possessedPawn->GetName());
 		return;
 	}
 
@@ -29,7 +29,7 @@ void AController::UnPossess()
 {
 	if (_possessedPawn == nullptr)
 	{
-		LogSystem::Log(LogController, Verbose, L"The controller already detached any pawn. Abort.");
+		LogSystem::Log<Verbose>(LogController, L"The controller already detached any pawn. Abort.");
 		return;
 	}
 
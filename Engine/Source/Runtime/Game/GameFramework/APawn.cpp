@@ -16,7 +16,7 @@ void APawn::PossessedBy(AController* controller)
 {
 	if (_controller != nullptr)
 	{
-		LogSystem::Log(LogPawn, Error, L"The pawn already possessed by controller[{}]. Abort.", controller->GetName());
+		LogSystem::Log<Error>(LogPawn, L"The pawn already possessed by controller[{}]. Abort.", controller->GetName());
 		return;
 	}
 
@@ -40,7 +40,7 @@ void GameInstance::InitializeEngine()
 	constexpr bool bDebug = false;
 #endif
 
-	_engine = CreateSubobject<GameEngine>(bDebug);
+	_engine = CreateSubobject<GameEngine>(bDebug, DeviceType);
 	_engine->InitEngine(this);
 
 	_world = CreateSubobject<World>();
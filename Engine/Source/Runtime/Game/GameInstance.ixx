@@ -33,6 +33,11 @@ private:
 public:
 	SubclassOf<Level> StartupLevel;
 
+	/// <summary>
+	/// Specify backend of render device. Use null device to run engine without GPU.
+	/// </summary>
+	ERHIDeviceType DeviceType = ERHIDeviceType::D3D12;
+
 public:
 	/// <summary>
 	/// Initialize new <see cref="GameInstance"/> instance.
@@ -18,7 +18,7 @@ bool Level::LoadLevel(World* world)
 {
 	if (!GameModeClass.IsValid())
 	{
-		LogSystem::Log(LogWorld, Error, L"GameModeClass does not specified. Abort.");
+		LogSystem::Log<Error>(LogWorld, L"GameModeClass does not specified. Abort.");
 		return false;
 	}
 
@@ -9,8 +9,13 @@ using enum ELogVerbosity;
 using namespace std;
 using namespace std::chrono;
 
-World::World()
+World::World(bool bUseSubobjectArena)
 {
+	// Spawned actors and their components are carved from arena owned by this world.
+	if (bUseSubobjectArena)
+	{
+		EnableSubobjectArena();
+	}
 }
 
 World::~World()
@@ -21,34 +26,96 @@ bool World::LoadLevel(SubclassOf<Level> levelToLoad)
 {
 	if (!levelToLoad.IsValid())
 	{
-		LogSystem::Log(LogWorld, Error, L"The parameter that specified class of desired to load level is nullptr. Abort.");
+		LogSystem::Log<Error>(LogWorld, L"The parameter that specified class of desired to load level is nullptr. Abort.");
 		return false;
 	}
 
 	// Clear spawned actors.
-	for (auto& actor : _actors)
+	while (_actors.GetCount() != 0)
 	{
-		DestroySubobject(actor);
+		DestroyActor(_actors.GetItems().back());
 	}
-	_actors.clear();
 
 	Level* levelInstance = levelToLoad.Instantiate(this);
 	if (!levelInstance->LoadLevel(this))
 	{
-		LogSystem::Log(LogWorld, Fatal, L"Could not load level.");
+		LogSystem::Log<Fatal>(LogWorld, L"Could not load level.");
 		return false;
 	}
 
 	return true;
 }
 
+void World::DestroyActor(AActor* actor)
+{
+	if (actor == nullptr || actor->GetWorld() != this)
+	{
+		LogSystem::Log<Error>(LogWorld, L"Request destroy actor but target is not spawned to this world. Abort.");
+		return;
+	}
+
+	// Unregister all actor components.
+	vector<ActorComponent*> actorComponents = actor->GetOwnedComponents();
+	for (auto& ac : actorComponents)
+	{
+		ac->UnregisterComponentWithWorld();
+	}
+
+	// Unregister all scene components.
+	actor->ForEachSceneComponents([](SceneComponent* component)
+	{
+		component->UnregisterComponentWithWorld();
+		return false;
+	});
+
+	// Actor is invalid immediately and destroyed at end of frame.
+	_actors.Remove(actor->GetHandle());
+	actor->UnregisterActorWithWorld();
+	actor->MarkPendingKill();
+}
+
+AActor* World::ResolveActor(const ObjectHandle& handle) const
+{
+	AActor* const* actor = _actors.Find(handle);
+	return actor != nullptr ? *actor : nullptr;
+}
+
+ActorComponent* World::ResolveComponent(const ObjectHandle& handle) const
+{
+	ActorComponent* const* component = _components.Find(handle);
+	return component != nullptr ? *component : nullptr;
+}
+
 void World::RegisterTickFunction(TickFunction* function)
 {
-	_tickInstances.emplace(function);
+	_tickGraph.Register(function);
+}
+
+void World::UnregisterTickFunction(TickFunction* function)
+{
+	_tickGraph.Unregister(function);
+}
+
+ObjectHandle World::RegisterComponent(ActorComponent* component)
+{
+	return _components.Add(component);
+}
+
+void World::UnregisterComponent(ActorComponent* component)
+{
+	_components.Remove(component->GetHandle());
 }
 
 bool World::InternalSpawnActor(AActor* instance)
 {
+	if (instance->GetWorld() != nullptr)
+	{
+		LogSystem::Log<Error>(LogWorld, L"Actor is already spawned to world. Abort.");
+		return false;
+	}
+
+	instance->RegisterActorWithWorld(this, _actors.Add(instance));
+
 	// Register all actor components.
 	vector<ActorComponent*> actorComponents = instance->GetOwnedComponents();
 	for (auto& ac : actorComponents)
@@ -63,9 +130,10 @@ bool World::InternalSpawnActor(AActor* instance)
 		return false;
 	});
 
-	return _actors.emplace(instance).second;
+	return true;
 }
 
 void World::LevelTick(duration<float> elapsedTime)
 {
+	_tickGraph.Execute(elapsedTime);
 }
\ No newline at end of file
@@ -6,9 +6,11 @@ import std.core;
 import SC.Runtime.Core;
 import :GameConcepts;
 import :AActor;
+import :ActorComponent;
 import :SubclassOf;
 import :LogGame;
 import :TickFunction;
+import :TickGraph;
 
 using enum ELogVerbosity;
 using namespace std;
@@ -25,15 +27,17 @@ public:
 	using Super = Object;
 
 private:
-	set<AActor*> _actors;
+	HandleTable<AActor*> _actors;
+	HandleTable<ActorComponent*> _components;
 	Level* _level = nullptr;
-	set<TickFunction*> _tickInstances;
+	TickGraph _tickGraph;
 
 public:
 	/// <summary>
 	/// Initialize new <see cref="World"/> instance.
 	/// </summary>
-	World();
+	/// <param name="bUseSubobjectArena"> Carve spawned actors and their components from arena owned by this world. </param>
+	World(bool bUseSubobjectArena = true);
 	~World();
 
 	/// <summary>
@@ -62,7 +66,7 @@ public:
 	{
 		if (!actorClass.IsValid())
 		{
-			LogSystem::Log(LogWorld, Error, L"Actor class does not specified. Abort.");
+			LogSystem::Log<Error>(LogWorld, L"Actor class does not specified. Abort.");
 			return nullptr;
 		}
 
@@ -83,17 +87,74 @@ public:
 	template<derived_from<AActor> T>
 	T* SpawnActor(SubclassOf<T> actorClass)
 	{
-		return dynamic_cast<T*>(SpawnActor(SubclassOf<AActor>(actorClass)));
+		return static_cast<T*>(SpawnActor(SubclassOf<AActor>(actorClass)));
 	}
 
+	/// <summary>
+	/// Destroy actor that spawned to this world. All handles that refer to the actor and its components will be stale immediately,
+	/// and the actor is destroyed on next flush of <see cref="PendingKillQueue"/>.
+	/// </summary>
+	/// <param name="actor"> The actor to destroy. </param>
+	void DestroyActor(AActor* actor);
+
+	/// <summary>
+	/// Resolve actor handle.
+	/// </summary>
+	/// <param name="handle"> The actor handle. </param>
+	/// <returns> The actor. Return nullptr if the actor is destroyed. </returns>
+	AActor* ResolveActor(const ObjectHandle& handle) const;
+
+	/// <summary>
+	/// Resolve actor handle.
+	/// </summary>
+	/// <typeparam name="T"> The actor class. </typeparam>
+	/// <param name="handle"> The actor handle. </param>
+	/// <returns> The actor. Return nullptr if the actor is destroyed or is not desired class. </returns>
+	template<derived_from<AActor> T>
+	T* ResolveActor(const ObjectHandle& handle) const
+	{
+		AActor* actor = ResolveActor(handle);
+		return actor != nullptr && actor->IsA<T>() ? static_cast<T*>(actor) : nullptr;
+	}
+
+	/// <summary>
+	/// Resolve component handle.
+	/// </summary>
+	/// <param name="handle"> The component handle. </param>
+	/// <returns> The component. Return nullptr if the component is destroyed. </returns>
+	ActorComponent* ResolveComponent(const ObjectHandle& handle) const;
+
+	/// <summary>
+	/// Resolve component handle.
+	/// </summary>
+	/// <typeparam name="T"> The component class. </typeparam>
+	/// <param name="handle"> The component handle. </param>
+	/// <returns> The component. Return nullptr if the component is destroyed or is not desired class. </returns>
+	template<derived_from<ActorComponent> T>
+	T* ResolveComponent(const ObjectHandle& handle) const
+	{
+		ActorComponent* component = ResolveComponent(handle);
+		return component != nullptr && component->IsA<T>() ? static_cast<T*>(component) : nullptr;
+	}
+
+	/// <summary>
+	/// Get all spawned actors as contiguous array.
+	/// </summary>
+	span<AActor* const> GetActors() const { return _actors.GetItems(); }
+
 	/// <summary>
 	/// Load level.
 	/// </summary>
 	bool LoadLevel(SubclassOf<Level> levelToLoad);
 
 	void RegisterTickFunction(TickFunction* function);
+	void UnregisterTickFunction(TickFunction* function);
 	virtual void LevelTick(duration<float> elapsedTime);
 
+public /*internal*/:
+	ObjectHandle RegisterComponent(ActorComponent* component);
+	void UnregisterComponent(ActorComponent* component);
+
 private:
 	bool InternalSpawnActor(AActor* instance);
 };
\ No newline at end of file
@@ -0,0 +1,126 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Runtime.Game;
+
+using namespace std;
+using namespace std::chrono;
+
+using enum ELogVerbosity;
+
+RenderThread::RenderThread(RHICommandQueue* queue, int32 numFramesInFlight, FrameRenderer renderer) : Super()
+	, _queue(queue)
+	, _numFramesInFlight(max(numFramesInFlight, 1))
+	, _renderer(move(renderer))
+	, _frameFences(_numFramesInFlight, 0)
+{
+	LogSystem::Log<Info>(LogEngine, L"Start render thread with {} frames in flight.", _numFramesInFlight);
+	_thread = thread([this]() { Worker(); });
+}
+
+RenderThread::~RenderThread()
+{
+	Shutdown();
+}
+
+void RenderThread::EnqueueFrame(FramePacket packet)
+{
+	unique_lock lock(_lock);
+	if (!_bRunning)
+	{
+		LogSystem::Log<Error>(LogEngine, L"Render thread is already shutdown. Frame is dropped.");
+		return;
+	}
+
+	if (_pendingPacket.has_value())
+	{
+		steady_clock::time_point begin = steady_clock::now();
+		_signal.wait(lock, [this]() { return !_pendingPacket.has_value(); });
+		_gameThreadWaitTicks.fetch_add((steady_clock::now() - begin).count(), memory_order_relaxed);
+	}
+
+	_pendingPacket = move(packet);
+	_signal.notify_all();
+}
+
+void RenderThread::Flush()
+{
+	uint64 lastFrameFence = 0;
+	{
+		unique_lock lock(_lock);
+		_signal.wait(lock, [this]() { return !_pendingPacket.has_value() && !_bRendering; });
+		lastFrameFence = _lastFrameFence;
+	}
+
+	// Frames are signaled in order, so the last frame fence covers all frames.
+	if (_queue != nullptr)
+	{
+		_queue->WaitSignal(lastFrameFence);
+	}
+}
+
+void RenderThread::Shutdown()
+{
+	{
+		unique_lock lock(_lock);
+		if (!_bRunning)
+		{
+			return;
+		}
+
+		_bRunning = false;
+		_signal.notify_all();
+	}
+
+	_thread.join();
+
+	if (_queue != nullptr)
+	{
+		_queue->WaitLastSignal();
+	}
+}
+
+void RenderThread::Worker()
+{
+	while (true)
+	{
+		FramePacket packet;
+		{
+			unique_lock lock(_lock);
+			_signal.wait(lock, [this]() { return _pendingPacket.has_value() || !_bRunning; });
+			if (!_pendingPacket.has_value())
+			{
+				break;
+			}
+
+			packet = move(_pendingPacket.value());
+			_pendingPacket.reset();
+			_bRendering = true;
+		}
+
+		// Game thread can produce next packet while this frame is rendering.
+		_signal.notify_all();
+
+		// Wait for GPU completes the frame that used same slot before.
+		const int32 frameIndex = (int32)(packet.FrameNumber % (uint64)_numFramesInFlight);
+		if (_queue != nullptr)
+		{
+			steady_clock::time_point begin = steady_clock::now();
+			_queue->WaitSignal(_frameFences[frameIndex]);
+			_gpuWaitTicks.fetch_add((steady_clock::now() - begin).count(), memory_order_relaxed);
+		}
+
+		_frameFences[frameIndex] = _renderer(packet, frameIndex);
+		_numFramesRendered.fetch_add(1, memory_order_relaxed);
+
+		{
+			unique_lock lock(_lock);
+			_lastFrameFence = _frameFences[frameIndex];
+			_bRendering = false;
+		}
+		_signal.notify_all();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Game:RenderThread;
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents snapshot of game thread state that render thread consumes to render single frame.
+/// </summary>
+export struct FramePacket
+{
+	uint64 FrameNumber = 0;
+	uint64 UploadMarker = 0;
+	duration<float> ElapsedTime = 0ns;
+	float InterpolationAlpha = 1.0f;
+	int32 ViewportWidth = 0;
+	int32 ViewportHeight = 0;
+};
+
+/// <summary>
+/// Represents thread that render frame packets produced by game thread.
+/// Game thread can produce next frame while render thread records current frame, and up to N frames can be in flight on GPU.
+/// Each frame slot is reused after GPU completes fence value of the frame that used the slot before.
+/// </summary>
+export class RenderThread : virtual public Object
+{
+public:
+	using Super = Object;
+
+	/// <summary>
+	/// Represents function that render frame packet with frame slot index, and return fence value that signaled after frame.
+	/// </summary>
+	using FrameRenderer = function<uint64(const FramePacket&, int32)>;
+
+private:
+	RHICommandQueue* _queue = nullptr;
+	const int32 _numFramesInFlight;
+	FrameRenderer _renderer;
+
+	thread _thread;
+	mutex _lock;
+	condition_variable _signal;
+	optional<FramePacket> _pendingPacket;
+	bool _bRendering = false;
+	bool _bRunning = true;
+
+	vector<uint64> _frameFences;
+	uint64 _lastFrameFence = 0;
+	atomic<uint64> _numFramesRendered = 0;
+	atomic<int64> _gameThreadWaitTicks = 0;
+	atomic<int64> _gpuWaitTicks = 0;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RenderThread"/> instance.
+	/// </summary>
+	/// <param name="queue"> The command queue that frames are submitted. nullptr to render frames without fence gating. </param>
+	/// <param name="numFramesInFlight"> The maximum count of frames in flight. </param>
+	/// <param name="renderer"> The frame renderer. </param>
+	RenderThread(RHICommandQueue* queue, int32 numFramesInFlight, FrameRenderer renderer);
+	~RenderThread() override;
+
+	/// <summary>
+	/// Enqueue frame packet. Blocks calling thread if render thread have not consumed previous packet.
+	/// </summary>
+	/// <param name="packet"> The frame packet. </param>
+	void EnqueueFrame(FramePacket packet);
+
+	/// <summary>
+	/// Wait for all enqueued frames are rendered and executed by GPU. Commands that submitted to queue outside of frames are not waited.
+	/// </summary>
+	void Flush();
+
+	/// <summary>
+	/// Stop render thread after rendering all enqueued frames.
+	/// </summary>
+	void Shutdown();
+
+	/// <summary>
+	/// Get maximum count of frames in flight.
+	/// </summary>
+	inline int32 GetNumFramesInFlight() const { return _numFramesInFlight; }
+
+	/// <summary>
+	/// Get count of rendered frames.
+	/// </summary>
+	inline uint64 GetNumFramesRendered() const { return _numFramesRendered.load(memory_order_relaxed); }
+
+	/// <summary>
+	/// Get accumulated time that game thread was blocked by render thread.
+	/// </summary>
+	inline duration<float> GetGameThreadWaitTime() const { return steady_clock::duration(_gameThreadWaitTicks.load(memory_order_relaxed)); }
+
+	/// <summary>
+	/// Get accumulated time that render thread was blocked by GPU to reuse frame slot.
+	/// </summary>
+	inline duration<float> GetGPUWaitTime() const { return steady_clock::duration(_gpuWaitTicks.load(memory_order_relaxed)); }
+
+private:
+	void Worker();
+};
\ No newline at end of file
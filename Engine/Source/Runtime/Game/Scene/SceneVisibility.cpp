@@ -19,18 +19,9 @@ void SceneVisibility::FrustumCull()
 {
 }
 
-void SceneVisibility::ReadyBuffer(size_t capa, bool bAllowShrink)
+void SceneVisibility::ReadyBuffer(size_t capa)
 {
+	// View constants are transient data of this frame. Allocate from upload ring buffer instead of creating resource.
 	RHIDevice* dev = _owner->GetDevice();
-	size_t prev = sizeof(RHIViewConstants) * _viewBufCapa;
-	size_t next = sizeof(RHIViewConstants) * capa;
-
-	if (prev >= next)
-	{
-		// The view buffer not be allowed to shrink. Return immediately.
-		return;
-	}
-
-	DestroySubobject(_viewBuffer);
-	_viewBuffer = dev->CreateDynamicBuffer(next);
+	_viewBuffer = dev->GetUploadRingBuffer()->Allocate(sizeof(RHIViewConstants) * capa);
 }
\ No newline at end of file
@@ -19,8 +19,7 @@ public:
 
 private:
 	Scene* _owner = nullptr;
-	RHIResource* _viewBuffer = nullptr;
-	size_t _viewBufCapa = 0;
+	RHIUploadAllocation _viewBuffer;
 
 public:
 	SceneVisibility(Scene* owner);
@@ -29,5 +28,5 @@ public:
 
 private:
 	void FrustumCull();
-	void ReadyBuffer(size_t capa, bool bAllowShrink);
+	void ReadyBuffer(size_t capa);
 };
\ No newline at end of file
@@ -4,6 +4,7 @@ import SC.Runtime.Core;
 import SC.Runtime.Game.Shaders;
 import SC.Runtime.RenderCore;
 import std.core;
+import std.filesystem;
 
 #define BYTE uint8
 
@@ -12,10 +13,40 @@ import std.core;
 
 using namespace std;
 
+using enum ELogVerbosity;
+
+namespace
+{
+	bool ReadSource(const filesystem::path& filepath, string& outSource)
+	{
+		ifstream stream(filepath, ios::binary);
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		outSource.assign(istreambuf_iterator<char>(stream), istreambuf_iterator<char>());
+		return !stream.bad();
+	}
+}
+
 ColorShader::ColorShader(RHIDevice* device) : Super(device)
 {
 }
 
+void ColorShader::RegisterSources(RHIShaderBytecodeCache* cache, const filesystem::path& directory)
+{
+	RHIShaderSource vs = { .Name = L"ColorShaderVS.hlsl", .EntryPoint = "Main", .Target = "vs_5_1" };
+	RHIShaderSource ps = { .Name = L"ColorShaderPS.hlsl", .EntryPoint = "Main", .Target = "ps_5_1" };
+	if (!ReadSource(directory / vs.Name, vs.Source) || !ReadSource(directory / ps.Name, ps.Source))
+	{
+		LogSystem::Log<Warning>(LogRHI, L"Could not read sources of ColorShader. Fallback to precompiled bytecode.");
+		return;
+	}
+
+	SetBytecodeFuture(cache->Register(move(vs)), cache->Register(move(ps)));
+}
+
 span<uint8 const> ColorShader::CompileVS()
 {
 	return pColorShaderVS;
@@ -5,6 +5,7 @@ export module SC.Runtime.Game.Shaders:ColorShader;
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
 import std.core;
+import std.filesystem;
 
 using namespace std;
 
@@ -23,6 +24,14 @@ private:
 public:
 	ColorShader(RHIDevice* device);
 
+	/// <summary>
+	/// Register HLSL sources to bytecode cache, so they are compiled in parallel with other shaders.
+	/// Precompiled bytecode is used if sources are not found.
+	/// </summary>
+	/// <param name="cache"> The shader bytecode cache. </param>
+	/// <param name="directory"> The directory that contains ColorShaderVS.hlsl and ColorShaderPS.hlsl. </param>
+	void RegisterSources(RHIShaderBytecodeCache* cache, const filesystem::path& directory);
+
 	virtual vector<RHIShaderParameterElement> GetShaderParameterDeclaration() const override;
 
 protected:
@@ -19,10 +19,10 @@ export
 		template<class>
 		friend class SubclassOf;
 
-		inline static function<Object*(Object*)> _myctor;
+		inline static function<TBase*(Object*)> _myctor;
 
-		size_t _hash = 0;
-		function<Object*(Object*)> _ctor;
+		const ObjectClass* _class = nullptr;
+		function<TBase*(Object*)> _ctor;
 
 	public:
 		/// <summary>
@@ -36,7 +36,7 @@ export
 		/// Initialize new <see cref="SubclassOf"/> instance.
 		/// </summary>
 		inline SubclassOf(const SubclassOf& rhs)
-			: _hash(rhs._hash)
+			: _class(rhs._class)
 			, _ctor(rhs._ctor)
 		{
 		}
@@ -45,7 +45,7 @@ export
 		/// Initialize new <see cref="SubclassOf"/> instance.
 		/// </summary>
 		inline SubclassOf(SubclassOf&& rhs)
-			: _hash(rhs._hash)
+			: _class(rhs._class)
 			, _ctor(move(rhs._ctor))
 		{
 		}
@@ -55,8 +55,8 @@ export
 		/// </summary>
 		template<derived_from<TBase> TOther>
 		inline SubclassOf(const SubclassOf<TOther>& rhs)
-			: _hash(rhs._hash)
-			, _ctor(rhs._ctor)
+			: _class(rhs._class)
+			, _ctor(Upcast(rhs._ctor))
 		{
 		}
 
@@ -65,15 +65,20 @@ export
 		/// </summary>
 		template<derived_from<TBase> TOther>
 		inline SubclassOf(SubclassOf<TOther>&& rhs)
-			: _hash(rhs._hash)
-			, _ctor(move(rhs._ctor))
+			: _class(rhs._class)
+			, _ctor(Upcast(move(rhs._ctor)))
 		{
 		}
 
 		/// <summary>
 		/// Get identifier hash code.
 		/// </summary>
-		inline size_t GetHashCode() const { return _hash; }
+		inline size_t GetHashCode() const { return _class != nullptr ? _class->GetHashCode() : 0; }
+
+		/// <summary>
+		/// Get saved class.
+		/// </summary>
+		inline const ObjectClass* GetClass() const { return _class; }
 
 		/// <summary>
 		/// Represents this is valid state.
@@ -90,19 +95,19 @@ export
 			{
 				return nullptr;
 			}
-			return dynamic_cast<TBase*>(_ctor(outer));
+			return _ctor(outer);
 		}
 
 		inline SubclassOf& operator =(const SubclassOf& rhs)
 		{
-			_hash = rhs._hash;
+			_class = rhs._class;
 			_ctor = rhs._ctor;
 			return *this;
 		}
 
 		inline SubclassOf& operator =(SubclassOf&& rhs)
 		{
-			_hash = rhs._hash;
+			_class = rhs._class;
 			_ctor = move(rhs._ctor);
 			return *this;
 		}
@@ -110,27 +115,27 @@ export
 		template<derived_from<TBase> TOther>
 		inline SubclassOf& operator =(const SubclassOf<TOther>& rhs)
 		{
-			_hash = rhs._hash;
-			_ctor = rhs._ctor;
+			_class = rhs._class;
+			_ctor = Upcast(rhs._ctor);
 			return *this;
 		}
 
 		template<derived_from<TBase> TOther>
 		inline SubclassOf& operator =(SubclassOf<TOther>&& rhs)
 		{
-			_hash = rhs._hash;
-			_ctor = move(rhs._ctor);
+			_class = rhs._class;
+			_ctor = Upcast(move(rhs._ctor));
 			return *this;
 		}
 
 		inline bool operator ==(const SubclassOf& rhs) const
 		{
-			return _hash == rhs._hash;
+			return _class == rhs._class;
 		}
 
 		inline bool operator !=(const SubclassOf& rhs) const
 		{
-			return _hash != rhs._hash;
+			return _class != rhs._class;
 		}
 
 		/// <summary>
@@ -143,14 +148,30 @@ export
 			{
 				_myctor = [](Object* outer)
 				{
-					return static_cast<Object*>(outer->CreateSubobject<TBase>());
+					return outer->CreateSubobject<TBase>();
 				};
 			}
 
 			SubclassOf ins;
-			ins._hash = UniqueType<TBase>::HashCode;
+			ins._class = ObjectClass::StaticClass<TBase>();
 			ins._ctor = _myctor;
 			return ins;
 		}
+
+	private:
+		template<derived_from<TBase> TOther>
+		inline static function<TBase*(Object*)> Upcast(function<TOther*(Object*)> ctor)
+		{
+			if (!ctor)
+			{
+				return nullptr;
+			}
+
+			// Derived pointer is converted to base pointer statically, without RTTI.
+			return [ctor = move(ctor)](Object* outer) -> TBase*
+			{
+				return ctor(outer);
+			};
+		}
 	};
 }
\ No newline at end of file
@@ -13,34 +13,28 @@ TickFunction::TickFunction() : Super()
 
 TickFunction::~TickFunction()
 {
+	if (_registeredGraph != nullptr)
+	{
+		_registeredGraph->Unregister(this);
+	}
 }
 
 void TickFunction::Ready()
 {
 	_bExecutedFrame = false;
-	_actualTickGroup = TickGroup;
-
-	ComputeTickGroupDependency();
 }
 
 void TickFunction::ExecuteTick(duration<float> deltaTime)
 {
-	_bExecutedFrame = true;
-
-	for (auto& item : _pres)
-	{
-		if (item->_bExecutedFrame)
-		{
-			continue;
-		}
-
-		item->ExecuteTick(deltaTime);
-	}
 }
 
 void TickFunction::AddPrerequisiteFunction(TickFunction* function)
 {
 	_pres.emplace_back(function);
+	if (_registeredGraph != nullptr)
+	{
+		_registeredGraph->MarkDirty();
+	}
 }
 
 void TickFunction::RemovePrerequisiteFunction(TickFunction* function)
@@ -48,26 +42,61 @@ void TickFunction::RemovePrerequisiteFunction(TickFunction* function)
 	if (auto it = find(_pres.begin(), _pres.end(), function); it != _pres.end())
 	{
 		_pres.erase(it);
+		if (_registeredGraph != nullptr)
+		{
+			_registeredGraph->MarkDirty();
+		}
+	}
+}
+
+void TickFunction::InternalExecuteTick()
+{
+	if (bCanEverTick && _bTickDue)
+	{
+		ExecuteTick(_accumulatedTime);
+		_bExecutedFrame = true;
 	}
 }
 
-inline int32 Compare(ETickingGroup lh, ETickingGroup rh)
+void TickFunction::InternalScheduleInterval(float phase)
 {
-	return MathEx::Clamp<int32>((int32)lh - (int32)rh, -1, 1);
+	_scheduledInterval = TickInterval;
+	_intervalRemaining = TickInterval * phase;
+	_accumulatedTime = {};
 }
 
-void TickFunction::ComputeTickGroupDependency()
+void TickFunction::InternalReadyInterval(duration<float> elapsedTime)
 {
-	_actualTickGroup = TickGroup;
-	for (size_t i = 0; i < _pres.size(); ++i)
+	// Accumulated time of previous tick is consumed.
+	if (_bTickDue)
 	{
-		auto& function = _pres[i];
+		_accumulatedTime = {};
+	}
+
+	_accumulatedTime += elapsedTime;
+	_intervalRemaining -= elapsedTime;
+	_bTickDue = _intervalRemaining.count() <= 0;
 
-		// If compare return less than zero, this tick function will execute
-		// after execute tick of prerequisite tickable object.
-		if (Compare(TickGroup, function->TickGroup) < 0)
+	if (_bTickDue)
+	{
+		// Keep phase for next tick. If frame is longer than interval, tick once and skip missed ticks.
+		_intervalRemaining += TickInterval;
+		if (_intervalRemaining.count() <= 0)
 		{
-			_actualTickGroup = function->TickGroup;
+			_intervalRemaining = TickInterval;
 		}
 	}
+}
+
+void TickFunction::InternalSetActualTickGroup(ETickingGroup tickGroup)
+{
+	_actualTickGroup = tickGroup;
+}
+
+void TickFunction::InternalSetTickGraph(TickGraph* graph)
+{
+	_registeredGraph = graph;
+
+	// Stagger phase again when registered to graph.
+	_scheduledInterval = duration<float>(-1);
 }
\ No newline at end of file
@@ -9,6 +9,8 @@ import :TickingGroup;
 using namespace std;
 using namespace std::chrono;
 
+export class TickGraph;
+
 /// <summary>
 /// Represents tick function that proceed on game engine.
 /// </summary>
@@ -23,8 +25,16 @@ public:
 	/// </summary>
 	uint8 bCanEverTick : 1 = false;
 
+	/// <summary>
+	/// Specify that this tick function can be executed on worker threads concurrently with other tick functions.
+	/// Tick functions are executed on game thread by default. Parallel tick function must not call thread-unsafe APIs
+	/// such as spawning or destroying actors, creating subobjects, marking pending kill or registering tick functions.
+	/// </summary>
+	uint8 bAllowParallelTick : 1 = false;
+
 private:
 	uint8 _bExecutedFrame : 1 = false;
+	uint8 _bTickDue : 1 = false;
 
 public:
 	/// <summary>
@@ -38,13 +48,21 @@ public:
 	ETickingGroup TickGroup = ETickingGroup::PrePhysics;
 
 	/// <summary>
-	/// Tick interval.
+	/// Tick interval. Zero means tick on every frame.
+	/// Otherwise, function is ticked when interval is elapsed with accumulated elapsed time since previous tick,
+	/// and phase is staggered against other functions that have same interval.
 	/// </summary>
-	duration<float> TickInterval;
+	duration<float> TickInterval = {};
 
 private:
 	vector<TickFunction*> _pres;
 	ETickingGroup _actualTickGroup = ETickingGroup::PrePhysics;
+	TickGraph* _registeredGraph = nullptr;
+
+	// Interval that phase is scheduled with. Reschedule when TickInterval is changed.
+	duration<float> _scheduledInterval = {};
+	duration<float> _intervalRemaining = {};
+	duration<float> _accumulatedTime = {};
 
 public:
 	/// <summary>
@@ -52,6 +70,11 @@ public:
 	/// </summary>
 	inline ETickingGroup GetActualTickGroup() const { return _actualTickGroup; }
 
+	/// <summary>
+	/// Get prerequisite functions.
+	/// </summary>
+	inline span<TickFunction* const> GetPrerequisites() const { return _pres; }
+
 public:
 	/// <summary>
 	/// Initialize new <see cref="TickFunction"/> instance.
@@ -65,13 +88,13 @@ public:
 	virtual void Ready();
 
 	/// <summary>
-	/// Execute tick function.
+	/// Execute tick function. Prerequisite functions are already executed when this is called.
 	/// </summary>
 	/// <param name="elapsedTime"> The frame elapsed time. </param>
 	virtual void ExecuteTick(duration<float> elapsedTime);
 
 	/// <summary>
-	/// Add prerequisite function.
+	/// Add prerequisite function. Prerequisite in later ticking group moves this function to that group.
 	/// </summary>
 	void AddPrerequisiteFunction(TickFunction* function);
 
@@ -80,6 +103,11 @@ public:
 	/// </summary>
 	void RemovePrerequisiteFunction(TickFunction* function);
 
-private:
-	void ComputeTickGroupDependency();
+public /*internal*/:
+	void InternalExecuteTick();
+	bool InternalIsIntervalScheduled() const { return _scheduledInterval == TickInterval; }
+	void InternalScheduleInterval(float phase);
+	void InternalReadyInterval(duration<float> elapsedTime);
+	void InternalSetActualTickGroup(ETickingGroup tickGroup);
+	void InternalSetTickGraph(TickGraph* graph);
 };
\ No newline at end of file
@@ -0,0 +1,524 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+
+using namespace std;
+using namespace std::chrono;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	// Count of root functions that executed in single job.
+	constexpr size_t RootBatchSize = 64;
+
+	constexpr uint32 Unvisited = numeric_limits<uint32>::max();
+
+	// Find strongly connected components with Tarjan's algorithm, without recursion.
+	// Return component index of each node.
+	vector<uint32> FindStronglyConnectedComponents(const vector<vector<uint32>>& edges, uint32& numComponents)
+	{
+		const uint32 numNodes = (uint32)edges.size();
+		vector<uint32> indices(numNodes, Unvisited);
+		vector<uint32> lowLinks(numNodes, 0);
+		vector<uint32> components(numNodes, Unvisited);
+		vector<uint32> stack;
+		vector<pair<uint32, uint32>> callStack;
+		uint32 nextIndex = 0;
+		numComponents = 0;
+
+		for (uint32 root = 0; root < numNodes; ++root)
+		{
+			if (indices[root] != Unvisited)
+			{
+				continue;
+			}
+
+			callStack.emplace_back(root, 0);
+			while (!callStack.empty())
+			{
+				auto& [node, edgeIndex] = callStack.back();
+				if (edgeIndex == 0 && indices[node] == Unvisited)
+				{
+					indices[node] = lowLinks[node] = nextIndex++;
+					stack.emplace_back(node);
+				}
+
+				if (edgeIndex < edges[node].size())
+				{
+					uint32 next = edges[node][edgeIndex++];
+					if (indices[next] == Unvisited)
+					{
+						callStack.emplace_back(next, 0);
+					}
+					else if (components[next] == Unvisited)
+					{
+						lowLinks[node] = min(lowLinks[node], indices[next]);
+					}
+					continue;
+				}
+
+				if (lowLinks[node] == indices[node])
+				{
+					uint32 member;
+					do
+					{
+						member = stack.back();
+						stack.pop_back();
+						components[member] = numComponents;
+					} while (member != node);
+					++numComponents;
+				}
+
+				uint32 finished = node;
+				callStack.pop_back();
+				if (!callStack.empty())
+				{
+					uint32 parent = callStack.back().first;
+					lowLinks[parent] = min(lowLinks[parent], lowLinks[finished]);
+				}
+			}
+		}
+
+		return components;
+	}
+
+	// Van der Corput sequence in base 2. Consecutive values are spread evenly in [0, 1) at any count.
+	float RadicalInverse(uint32 value)
+	{
+		value = (value << 16) | (value >> 16);
+		value = ((value & 0x00FF00FF) << 8) | ((value & 0xFF00FF00) >> 8);
+		value = ((value & 0x0F0F0F0F) << 4) | ((value & 0xF0F0F0F0) >> 4);
+		value = ((value & 0x33333333) << 2) | ((value & 0xCCCCCCCC) >> 2);
+		value = ((value & 0x55555555) << 1) | ((value & 0xAAAAAAAA) >> 1);
+		return (float)value * 2.3283064365386963e-10f;
+	}
+}
+
+TickGraph::TickGraph()
+{
+}
+
+TickGraph::~TickGraph()
+{
+	for (auto& function : _functions)
+	{
+		function->InternalSetTickGraph(nullptr);
+	}
+}
+
+void TickGraph::Register(TickFunction* function)
+{
+	if (_functions.emplace(function).second)
+	{
+		function->InternalSetTickGraph(this);
+		_bDirty = true;
+	}
+}
+
+void TickGraph::Unregister(TickFunction* function)
+{
+	if (_functions.erase(function) != 0)
+	{
+		function->InternalSetTickGraph(nullptr);
+		_bDirty = true;
+	}
+}
+
+void TickGraph::Execute(duration<float> elapsedTime)
+{
+	if (_bDirty)
+	{
+		Rebuild();
+	}
+
+	for (auto& group : _groups)
+	{
+		if (!group.Nodes.empty())
+		{
+			ExecuteGroup(group, elapsedTime);
+		}
+	}
+}
+
+void TickGraph::Rebuild()
+{
+	_bDirty = false;
+	++_numRebuilds;
+
+	for (auto& group : _groups)
+	{
+		group.Nodes.clear();
+		group.Dependents.clear();
+		group.Roots.clear();
+	}
+
+	for (auto& function : _functions)
+	{
+		function->InternalSetActualTickGroup(function->TickGroup);
+	}
+
+	// Tick function is executed in the latest group of its prerequisites, through whole prerequisite chain.
+	// Prerequisites that are not registered are ignored, since they may be already destroyed.
+	for (bool bChanged = true; bChanged;)
+	{
+		bChanged = false;
+		for (auto& function : _functions)
+		{
+			for (auto& prerequisite : function->GetPrerequisites())
+			{
+				if (_functions.contains(prerequisite) && prerequisite->GetActualTickGroup() > function->GetActualTickGroup())
+				{
+					function->InternalSetActualTickGroup(prerequisite->GetActualTickGroup());
+					bChanged = true;
+				}
+			}
+		}
+	}
+
+	map<TickFunction*, uint32> indices;
+	for (auto& function : _functions)
+	{
+		Group& group = _groups[(size_t)function->GetActualTickGroup()];
+		indices.emplace(function, (uint32)group.Nodes.size());
+		group.Nodes.emplace_back(Node{ .Function = function });
+	}
+
+	size_t maxNodes = 0;
+	for (auto& group : _groups)
+	{
+		BuildGroup(group, indices);
+		maxNodes = max(maxNodes, group.Nodes.size());
+	}
+
+	if (_numPendingCounts < maxNodes)
+	{
+		_pendingCounts = make_unique<atomic<uint32>[]>(maxNodes);
+		_numPendingCounts = maxNodes;
+	}
+}
+
+void TickGraph::BuildGroup(Group& group, const map<TickFunction*, uint32>& indices)
+{
+	const uint32 numNodes = (uint32)group.Nodes.size();
+	if (numNodes == 0)
+	{
+		return;
+	}
+
+	// Collect edges that connect functions in same group. Prerequisites in previous group are already executed.
+	vector<vector<uint32>> edges(numNodes);
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		TickFunction* function = group.Nodes[i].Function;
+		for (auto& prerequisite : function->GetPrerequisites())
+		{
+			auto it = indices.find(prerequisite);
+			if (it != indices.end() && prerequisite->GetActualTickGroup() == function->GetActualTickGroup())
+			{
+				edges[it->second].emplace_back(i);
+			}
+		}
+	}
+
+	// Report cycles with names of functions, and drop edges in cycle so graph never stalls.
+	uint32 numComponents = 0;
+	vector<uint32> components = FindStronglyConnectedComponents(edges, numComponents);
+	if (numComponents != numNodes)
+	{
+		vector<vector<uint32>> members(numComponents);
+		for (uint32 i = 0; i < numNodes; ++i)
+		{
+			members[components[i]].emplace_back(i);
+		}
+
+		for (auto& cycle : members)
+		{
+			if (cycle.size() < 2)
+			{
+				continue;
+			}
+
+			wstring names;
+			for (auto& member : cycle)
+			{
+				names += names.empty() ? L"" : L", ";
+				names += group.Nodes[member].Function->ToString();
+			}
+			LogSystem::Log<Error>(LogTicking, L"Tick functions have cyclic prerequisites. Prerequisites between these functions are ignored: {}", names);
+		}
+	}
+
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		erase_if(edges[i], [&](uint32 dependent)
+		{
+			if (dependent == i)
+			{
+				LogSystem::Log<Error>(LogTicking, L"Tick function is prerequisite of itself. Prerequisite is ignored: {}", group.Nodes[i].Function->ToString());
+				return true;
+			}
+			return components[dependent] == components[i];
+		});
+	}
+
+	// Sort nodes in topological order with Kahn's algorithm.
+	vector<uint32> remaining(numNodes, 0);
+	for (auto& edge : edges)
+	{
+		for (auto& dependent : edge)
+		{
+			++remaining[dependent];
+		}
+	}
+
+	vector<uint32> order;
+	order.reserve(numNodes);
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (remaining[i] == 0)
+		{
+			order.emplace_back(i);
+		}
+	}
+
+	for (size_t cursor = 0; cursor < order.size(); ++cursor)
+	{
+		for (auto& dependent : edges[order[cursor]])
+		{
+			if (--remaining[dependent] == 0)
+			{
+				order.emplace_back(dependent);
+			}
+		}
+	}
+
+	// Flatten nodes and edges with sorted order.
+	vector<uint32> sortedIndices(numNodes);
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		sortedIndices[order[i]] = i;
+	}
+
+	vector<Node> sorted(numNodes);
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		const uint32 source = order[i];
+		Node& node = sorted[i];
+		node.Function = group.Nodes[source].Function;
+		node.FirstDependent = (uint32)group.Dependents.size();
+		node.NumDependents = (uint32)edges[source].size();
+
+		for (auto& dependent : edges[source])
+		{
+			group.Dependents.emplace_back(sortedIndices[dependent]);
+		}
+	}
+
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		for (uint32 j = 0; j < sorted[i].NumDependents; ++j)
+		{
+			++sorted[group.Dependents[sorted[i].FirstDependent + j]].NumPrerequisites;
+		}
+	}
+
+	for (uint32 i = 0; i < numNodes; ++i)
+	{
+		if (sorted[i].NumPrerequisites == 0)
+		{
+			group.Roots.emplace_back(i);
+		}
+	}
+
+	group.Nodes = move(sorted);
+}
+
+void TickGraph::ExecuteGroup(Group& group, duration<float> elapsedTime)
+{
+	// Without worker, execute functions with cached order on calling thread.
+	if (JobSystem::GetNumWorkers() == 0)
+	{
+		for (auto& node : group.Nodes)
+		{
+			ReadyFunction(node.Function, elapsedTime);
+			node.Function->InternalExecuteTick();
+		}
+		return;
+	}
+
+	struct GroupExecution
+	{
+		Group& MyGroup;
+		atomic<uint32>* PendingCounts;
+		atomic<size_t> NumRemaining;
+
+		mutex GameThreadLock;
+		condition_variable GameThreadWakeup;
+		vector<uint32> GameThreadReady;
+
+		GroupExecution(Group& group, atomic<uint32>* pendingCounts)
+			: MyGroup(group)
+			, PendingCounts(pendingCounts)
+			, NumRemaining(group.Nodes.size())
+		{
+		}
+
+		void Dispatch(uint32 index)
+		{
+			if (!MyGroup.Nodes[index].Function->bAllowParallelTick)
+			{
+				{
+					unique_lock lock(GameThreadLock);
+					GameThreadReady.emplace_back(index);
+				}
+				GameThreadWakeup.notify_one();
+			}
+			else
+			{
+				JobSystem::Schedule([this, index]() { Execute(index); });
+			}
+		}
+
+		void Execute(uint32 index)
+		{
+			Node& node = MyGroup.Nodes[index];
+			node.Function->InternalExecuteTick();
+
+			for (uint32 i = 0; i < node.NumDependents; ++i)
+			{
+				uint32 dependent = MyGroup.Dependents[node.FirstDependent + i];
+				if (PendingCounts[dependent].fetch_sub(1, memory_order_acq_rel) == 1)
+				{
+					Dispatch(dependent);
+				}
+			}
+
+			Complete();
+		}
+
+		void Complete()
+		{
+			size_t remaining = NumRemaining.load(memory_order_acquire);
+			while (true)
+			{
+				if (remaining != 1)
+				{
+					if (NumRemaining.compare_exchange_weak(remaining, remaining - 1, memory_order_acq_rel))
+					{
+						return;
+					}
+					continue;
+				}
+
+				// Last function completes while holding lock, so game thread that acquired lock after completion
+				// can destroy this safely.
+				unique_lock lock(GameThreadLock);
+				if (NumRemaining.compare_exchange_strong(remaining, 0, memory_order_acq_rel))
+				{
+					GameThreadWakeup.notify_all();
+					return;
+				}
+			}
+		}
+
+		bool TryExecuteGameThread()
+		{
+			uint32 index;
+			{
+				unique_lock lock(GameThreadLock);
+				if (GameThreadReady.empty())
+				{
+					return false;
+				}
+
+				index = GameThreadReady.back();
+				GameThreadReady.pop_back();
+			}
+
+			Execute(index);
+			return true;
+		}
+
+		void Wait()
+		{
+			while (true)
+			{
+				if (TryExecuteGameThread() || JobSystem::TryExecuteJob())
+				{
+					continue;
+				}
+
+				// Nothing to help. Sleep until game thread function is ready or all functions are completed.
+				unique_lock lock(GameThreadLock);
+				GameThreadWakeup.wait(lock, [this]() { return !GameThreadReady.empty() || NumRemaining.load(memory_order_acquire) == 0; });
+				if (NumRemaining.load(memory_order_acquire) == 0)
+				{
+					return;
+				}
+			}
+		}
+	};
+
+	// Single linear pass that resets states for this frame.
+	for (uint32 i = 0; i < (uint32)group.Nodes.size(); ++i)
+	{
+		Node& node = group.Nodes[i];
+		ReadyFunction(node.Function, elapsedTime);
+		_pendingCounts[i].store(node.NumPrerequisites, memory_order_relaxed);
+	}
+
+	GroupExecution execution(group, _pendingCounts.get());
+
+	// Game thread roots are queued directly. Parallel root functions are executed in batch to amortize scheduling cost.
+	_parallelRoots.clear();
+	for (uint32 index : group.Roots)
+	{
+		if (group.Nodes[index].Function->bAllowParallelTick)
+		{
+			_parallelRoots.emplace_back(index);
+		}
+		else
+		{
+			execution.Dispatch(index);
+		}
+	}
+
+	for (size_t i = 0; i < _parallelRoots.size(); i += RootBatchSize)
+	{
+		size_t end = min(_parallelRoots.size(), i + RootBatchSize);
+		JobSystem::Schedule([this, &execution, i, end]()
+		{
+			for (size_t j = i; j < end; ++j)
+			{
+				execution.Execute(_parallelRoots[j]);
+			}
+		});
+	}
+
+	execution.Wait();
+}
+
+
+void TickGraph::ReadyFunction(TickFunction* function, duration<float> elapsedTime)
+{
+	function->Ready();
+
+	// Functions that have same interval are placed in same bucket, and phase of each function is staggered
+	// so ticks are spread across frames evenly instead of being due at same frame.
+	if (!function->InternalIsIntervalScheduled())
+	{
+		float phase = 0;
+		if (function->TickInterval.count() > 0)
+		{
+			int64 bucket = duration_cast<microseconds>(function->TickInterval).count();
+			phase = RadicalInverse(_intervalBuckets[bucket]++);
+		}
+		function->InternalScheduleInterval(phase);
+	}
+
+	function->InternalReadyInterval(elapsedTime);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.Game:TickGraph;
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import :TickFunction;
+import :TickingGroup;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents dependency graph of registered tick functions. Topological order of each ticking group is cached,
+/// and is rebuilt only when registration or prerequisites are changed.
+/// Each ticking group is executed in order, and tick functions in the group are executed as soon as their prerequisites are executed,
+/// on game thread or on worker threads if they allow parallel tick. Functions that have tick interval are ticked only when they are due.
+/// </summary>
+export class TickGraph
+{
+public:
+	/// <summary>
+	/// The count of ticking groups.
+	/// </summary>
+	static constexpr size_t NumTickingGroups = (size_t)ETickingGroup::PostUpdateWork + 1;
+
+private:
+	struct Node
+	{
+		TickFunction* Function = nullptr;
+		uint32 NumPrerequisites = 0;
+		uint32 FirstDependent = 0;
+		uint32 NumDependents = 0;
+	};
+
+	struct Group
+	{
+		// Nodes are sorted in topological order.
+		vector<Node> Nodes;
+		vector<uint32> Dependents;
+		vector<uint32> Roots;
+	};
+
+	set<TickFunction*> _functions;
+	bool _bDirty = false;
+
+	array<Group, NumTickingGroups> _groups;
+	unique_ptr<atomic<uint32>[]> _pendingCounts;
+	vector<uint32> _parallelRoots;
+	size_t _numPendingCounts = 0;
+	size_t _numRebuilds = 0;
+
+	// Count of functions that scheduled for each tick interval, in microseconds.
+	map<int64, uint32> _intervalBuckets;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="TickGraph"/> instance.
+	/// </summary>
+	TickGraph();
+	~TickGraph();
+
+	/// <summary>
+	/// Register tick function. TickGroup should be specified before registration.
+	/// </summary>
+	/// <param name="function"> The tick function. </param>
+	void Register(TickFunction* function);
+
+	/// <summary>
+	/// Unregister tick function.
+	/// </summary>
+	/// <param name="function"> The tick function. </param>
+	void Unregister(TickFunction* function);
+
+	/// <summary>
+	/// Request rebuild of cached order before next execution.
+	/// </summary>
+	void MarkDirty() { _bDirty = true; }
+
+	/// <summary>
+	/// Execute all tick functions that can ever tick. Calling thread executes functions that do not allow parallel tick, and helps worker threads.
+	/// </summary>
+	/// <param name="elapsedTime"> The frame elapsed time. </param>
+	void Execute(duration<float> elapsedTime);
+
+	/// <summary>
+	/// Get count of registered tick functions.
+	/// </summary>
+	size_t GetNumFunctions() const { return _functions.size(); }
+
+	/// <summary>
+	/// Get count of rebuilding cached order.
+	/// </summary>
+	size_t GetNumRebuilds() const { return _numRebuilds; }
+
+private:
+	void Rebuild();
+	void BuildGroup(Group& group, const map<TickFunction*, uint32>& indices);
+	void ExecuteGroup(Group& group, duration<float> elapsedTime);
+	void ReadyFunction(TickFunction* function, duration<float> elapsedTime);
+};
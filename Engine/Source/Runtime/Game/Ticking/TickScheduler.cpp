@@ -0,0 +1,164 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+
+using namespace std;
+using namespace std::chrono;
+
+TickScheduler::TickScheduler() : Super()
+{
+}
+
+void TickScheduler::Tick(duration<float> deltaTime)
+{
+	_time += deltaTime;
+	_bTicking = true;
+
+	// Ticking state is restored even if task throws, or all schedules that added later are deferred forever.
+	ScopeGuard tickingGuard([this]()
+	{
+		_bTicking = false;
+
+		// Entries that pushed while ticking are inserted after, so that each task is called at most once per tick.
+		for (auto& entry : _deferredEntries)
+		{
+			_dueHeap.emplace_back(entry);
+			push_heap(_dueHeap.begin(), _dueHeap.end(), greater<DueEntry>());
+		}
+		_deferredEntries.clear();
+	});
+
+	while (!_dueHeap.empty() && _dueHeap.front().DueTime <= _time)
+	{
+		pop_heap(_dueHeap.begin(), _dueHeap.end(), greater<DueEntry>());
+		DueEntry entry = _dueHeap.back();
+		_dueHeap.pop_back();
+
+		auto it = _tasks.find(entry.Id);
+		if (it == _tasks.end() || it->second.Sequence != entry.Sequence)
+		{
+			continue;
+		}
+
+		// Task can add or remove schedules, include itself. Table can be rehashed, so lookup again after each call.
+		function<void()> task = move(it->second.Task);
+		bool bReliableCallCount = it->second.bReliableCallCount;
+		duration<float> delay = it->second.Delay;
+		duration<double> dueTime = entry.DueTime;
+
+		auto reschedule = [&]()
+		{
+			if (it = _tasks.find(entry.Id); it != _tasks.end() && it->second.Sequence == entry.Sequence)
+			{
+				TickTaskInfo& info = it->second;
+				info.Task = move(task);
+				info.DueTime = dueTime;
+				PushDueEntry(entry.Id, info);
+			}
+		};
+
+		for (uint32 calls = 0; ; )
+		{
+			// Task is moved out of table, so it must be restored even if it throws, or schedule never fires again.
+			try
+			{
+				task();
+			}
+			catch (...)
+			{
+				dueTime = _time + delay;
+				reschedule();
+				throw;
+			}
+
+			if (it = _tasks.find(entry.Id); it == _tasks.end() || it->second.Sequence != entry.Sequence)
+			{
+				break;
+			}
+
+			if (!bReliableCallCount)
+			{
+				dueTime = _time + delay;
+				break;
+			}
+
+			// Due time of task without delay never passes current time, so it is called once per tick without catching up.
+			if (delay <= 0ns)
+			{
+				dueTime = _time;
+				break;
+			}
+
+			dueTime += delay;
+			if (dueTime > _time)
+			{
+				break;
+			}
+
+			if (++calls >= _maxCatchUpCalls)
+			{
+				dueTime = _time + delay;
+				break;
+			}
+		}
+
+		reschedule();
+	}
+}
+
+int64 TickScheduler::AddSchedule(const TickScheduleTaskInfo& taskInfo)
+{
+	TickTaskInfo internalInfo;
+	internalInfo.Task = taskInfo.Task;
+	internalInfo.Delay = taskInfo.Delay;
+	internalInfo.DueTime = _time + taskInfo.InitDelay;
+	internalInfo.bReliableCallCount = taskInfo.bReliableCallCount;
+
+	int64 id = _id++;
+	auto [it, bInserted] = _tasks.emplace(id, move(internalInfo));
+	PushDueEntry(id, it->second);
+	return id;
+}
+
+void TickScheduler::RemoveSchedule(int64 taskId)
+{
+	// Entry in heap will be skipped as stale.
+	if (_tasks.erase(taskId) != 0 && _dueHeap.size() > _tasks.size() * 2 + 64)
+	{
+		CompactDueHeap();
+	}
+}
+
+void TickScheduler::PushDueEntry(int64 id, TickTaskInfo& info)
+{
+	info.Sequence = ++_sequence;
+	DueEntry entry = { .DueTime = info.DueTime, .Id = id, .Sequence = info.Sequence };
+
+	if (_bTicking)
+	{
+		_deferredEntries.emplace_back(entry);
+	}
+	else
+	{
+		_dueHeap.emplace_back(entry);
+		push_heap(_dueHeap.begin(), _dueHeap.end(), greater<DueEntry>());
+	}
+}
+
+void TickScheduler::CompactDueHeap()
+{
+	// Heap is being consumed by Tick. Stale entries will be skipped.
+	if (_bTicking)
+	{
+		return;
+	}
+
+	erase_if(_dueHeap, [this](const DueEntry& entry)
+	{
+		auto it = _tasks.find(entry.Id);
+		return it == _tasks.end() || it->second.Sequence != entry.Sequence;
+	});
+	make_heap(_dueHeap.begin(), _dueHeap.end(), greater<DueEntry>());
+}
\ No newline at end of file
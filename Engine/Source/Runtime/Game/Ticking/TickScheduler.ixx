@@ -16,68 +16,95 @@ export struct TickScheduleTaskInfo
 	bool bReliableCallCount : 1 = false;
 };
 
+/// <summary>
+/// Represents scheduler that call tasks with delay. Tasks are ordered by absolute due time,
+/// so cost of each tick is proportional to count of tasks that are due.
+/// Adding and removing schedules from inside of task are safe.
+/// </summary>
 export class TickScheduler : virtual public Object
 {
 public:
 	using Super = Object;
 	using This = TickScheduler;
 
+	/// <summary>
+	/// The default value of maximum count of catch-up calls that task with reliable call count can be called in single tick.
+	/// </summary>
+	static constexpr uint32 DefaultMaxCatchUpCalls = 8;
+
 private:
 	struct TickTaskInfo
 	{
 		duration<float> Delay = 0ns;
-		duration<float> ActualDelay = 0ns;
+		duration<double> DueTime = 0ns;
+		uint64 Sequence = 0;
 		bool bReliableCallCount : 1 = false;
 
 		function<void()> Task;
 	};
 
-	atomic<int64> _id = 0;
-	map<size_t, TickTaskInfo> _tasks;
-
-public:
-	TickScheduler()
+	struct DueEntry
 	{
-	}
+		duration<double> DueTime;
+		int64 Id;
+		uint64 Sequence;
 
-	void Tick(duration<float> deltaTime)
-	{
-		for (auto& task : _tasks)
+		bool operator >(const DueEntry& rhs) const
 		{
-			auto& info = task.second;
-
-			info.ActualDelay -= deltaTime;
-			if (info.ActualDelay <= 0ns)
-			{
-				info.Task();
-
-				if (info.bReliableCallCount)
-				{
-					info.ActualDelay += info.Delay;
-				}
-				else
-				{
-					info.ActualDelay = info.Delay;
-				}
-			}
+			return DueTime > rhs.DueTime;
 		}
-	}
+	};
 
-	int64 AddSchedule(const TickScheduleTaskInfo& taskInfo)
-	{
-		TickTaskInfo internalInfo;
-		internalInfo.Task = taskInfo.Task;
-		internalInfo.Delay = taskInfo.Delay;
-		internalInfo.ActualDelay = taskInfo.InitDelay;
-		internalInfo.bReliableCallCount = taskInfo.bReliableCallCount;
-
-		int64 id = _id++;
-		_tasks.emplace(id, internalInfo);
-		return id;
-	}
-
-	void RemoveSchedule(int64 taskId)
-	{
-		_tasks.erase(taskId);
-	}
+	atomic<int64> _id = 0;
+	unordered_map<int64, TickTaskInfo> _tasks;
+
+	// Min-heap of due time. Entry is stale if task is removed or rescheduled after entry was pushed.
+	vector<DueEntry> _dueHeap;
+	vector<DueEntry> _deferredEntries;
+
+	duration<double> _time = 0ns;
+	uint64 _sequence = 0;
+	uint32 _maxCatchUpCalls = DefaultMaxCatchUpCalls;
+	bool _bTicking = false;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="TickScheduler"/> instance.
+	/// </summary>
+	TickScheduler();
+
+	/// <summary>
+	/// Advance time and call tasks that are due. Each task is called at most once per tick,
+	/// except task with reliable call count that catches up missed calls up to maximum catch-up calls.
+	/// </summary>
+	/// <param name="deltaTime"> The elapsed time. </param>
+	void Tick(duration<float> deltaTime);
+
+	/// <summary>
+	/// Add schedule. Schedule added in task is considered from next tick.
+	/// </summary>
+	/// <param name="taskInfo"> The task information. </param>
+	/// <returns> The task id. </returns>
+	int64 AddSchedule(const TickScheduleTaskInfo& taskInfo);
+
+	/// <summary>
+	/// Remove schedule. Task can remove schedule of itself.
+	/// </summary>
+	/// <param name="taskId"> The task id. </param>
+	void RemoveSchedule(int64 taskId);
+
+	/// <summary>
+	/// Set maximum count of catch-up calls that task with reliable call count can be called in single tick.
+	/// Remaining calls are dropped and next call is scheduled from current time.
+	/// </summary>
+	void SetMaxCatchUpCalls(uint32 count) { _maxCatchUpCalls = max(count, 1u); }
+
+	/// <summary>
+	/// Get count of scheduled tasks.
+	/// </summary>
+	size_t GetNumSchedules() const { return _tasks.size(); }
+
+private:
+	void PushDueEntry(int64 id, TickTaskInfo& info);
+	void CompactDueHeap();
 };
\ No newline at end of file
@@ -253,7 +253,7 @@ export
         {
             _com_error com_error(hr);
             std::wstring msg = com_error.ErrorMessage();
-            LogSystem::Log(category, ELogVerbosity::Fatal, msg);
+            LogSystem::Log<ELogVerbosity::Fatal>(category, L"{}", msg);
         }
     }
 
@@ -263,7 +263,7 @@ export
         {
             _com_error com_error(hr);
             std::wstring msg = com_error.ErrorMessage();
-            LogSystem::Log(category, ELogVerbosity::Error, msg);
+            LogSystem::Log<ELogVerbosity::Error>(category, L"{}", msg);
         }
     }
 }
\ No newline at end of file
@@ -3,4 +3,5 @@
 #pragma once
 
 #include <dxgi1_6.h>
-#include <d3d12.h>
\ No newline at end of file
+#include <d3d12.h>
+#include <d3dcompiler.h>
\ No newline at end of file
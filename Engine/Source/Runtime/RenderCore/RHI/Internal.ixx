@@ -18,6 +18,8 @@ export
 	typedef IID IID;
 	typedef D3D12_CPU_DESCRIPTOR_HANDLE D3D12_CPU_DESCRIPTOR_HANDLE;
 	typedef D3D12_GPU_DESCRIPTOR_HANDLE D3D12_GPU_DESCRIPTOR_HANDLE;
+	typedef D3D12_ROOT_SIGNATURE_DESC D3D12_ROOT_SIGNATURE_DESC;
+	typedef D3D12_GRAPHICS_PIPELINE_STATE_DESC D3D12_GRAPHICS_PIPELINE_STATE_DESC;
 
 	/* ----------- class declaration */
 	class _com_error;
@@ -5,11 +5,18 @@
 import SC.Runtime.RenderCore;
 import SC.Runtime.Core;
 import std.core;
+import std.threading;
 
 using namespace std;
+using namespace std::chrono;
 
 RHICommandQueue::RHICommandQueue(RHIDevice* device, ERHICommandType commandType) : Super(device)
 {
+	if (device->IsNullDevice())
+	{
+		return;
+	}
+
 	ID3D12Device* d3ddev = device->GetDevice();
 
 	D3D12_COMMAND_QUEUE_DESC desc =
@@ -19,8 +26,6 @@ RHICommandQueue::RHICommandQueue(RHIDevice* device, ERHICommandType commandType)
 
 	HR(LogRHI, d3ddev->CreateCommandQueue(&desc, IID_PPV_ARGS(&_queue)));
 	HR(LogRHI, d3ddev->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_fence)));
-
-	_fenceEvent = CreateSubobject<EventHandle>();
 }
 
 RHICommandQueue::~RHICommandQueue()
@@ -30,18 +35,27 @@ RHICommandQueue::~RHICommandQueue()
 }
 
 uint64 RHICommandQueue::Signal()
+{
+	unique_lock lock(_submitLock);
+	return InternalSignal();
+}
+
+uint64 RHICommandQueue::InternalSignal()
 {
 	uint64 fenceValue = ++_signalNumber;
-	HR(LogRHI, _queue->Signal(_fence.Get(), fenceValue));
+	if (_queue.IsSet())
+	{
+		HR(LogRHI, _queue->Signal(_fence.Get(), fenceValue));
+	}
 	return fenceValue;
 }
 
 void RHICommandQueue::WaitSignal(uint64 signalNumber)
 {
-	if (_fence->GetCompletedValue() < _signalNumber)
+	if (_fence.IsSet() && !IsComplete(signalNumber))
 	{
-		HR_E(LogRHI, _fence->SetEventOnCompletion(_signalNumber, _fenceEvent->GetHandle()));
-		_fenceEvent->Wait();
+		// Without event handle, it returns when fence reaches the value. Threads do not share event, so they can wait different values concurrently.
+		HR_E(LogRHI, _fence->SetEventOnCompletion(signalNumber, nullptr));
 	}
 }
 
@@ -50,13 +64,30 @@ void RHICommandQueue::WaitLastSignal()
 	WaitSignal(_signalNumber);
 }
 
+uint64 RHICommandQueue::GetCompletedValue() const
+{
+	if (!_fence.IsSet())
+	{
+		return _signalNumber;
+	}
+
+	return _fence->GetCompletedValue();
+}
+
 uint64 RHICommandQueue::ExecuteDeviceContexts(span<RHIDeviceContext*> deviceContexts)
 {
 	vector<ID3D12CommandList*> commandLists;
-	commandLists.reserve(deviceContexts.size());
+	commandLists.reserve(deviceContexts.size() * 2);
 
+	// Global resource states are updated in submission order, so resolving and executing are serialized.
+	unique_lock lock(_submitLock);
 	for (size_t i = 0; i < deviceContexts.size(); ++i)
 	{
+		if (ID3D12CommandList* resolve = deviceContexts[i]->ResolveResourceStates(); resolve != nullptr)
+		{
+			commandLists.emplace_back(resolve);
+		}
+
 		ID3D12CommandList* cmd = deviceContexts[i]->GetCommandList();
 		if (cmd != nullptr)
 		{
@@ -64,35 +95,59 @@ uint64 RHICommandQueue::ExecuteDeviceContexts(span<RHIDeviceContext*> deviceCont
 		}
 	}
 
-	_queue->ExecuteCommandLists((UINT)commandLists.size(), commandLists.data());
-	return Signal();
+	GetDevice()->AccumulateStatistics({ .NumExecutedDeviceContexts = (uint64)deviceContexts.size() });
+	if (_queue.IsSet())
+	{
+		_queue->ExecuteCommandLists((UINT)commandLists.size(), commandLists.data());
+	}
+
+	return InternalSignal();
 }
 
-int32 RHICommandQueue::Collect()
+int32 RHICommandQueue::Collect(optional<duration<float>> timeBudget)
 {
-	uint64 fenceValue = _signalNumber;
+	// Frames can be in flight, so collect only garbages that GPU completed.
+	steady_clock::time_point begin = steady_clock::now();
+	uint64 fenceValue = GetCompletedValue();
 	int32 count = 0;
 
-	while (!_gcobjects.empty())
+	while (true)
 	{
-		GarbageItem& item = _gcobjects.front();
-		if (item.FenceValue > fenceValue)
+		GarbageItem item;
 		{
-			return count;
+			unique_lock lock(_gclock);
+			auto it = _gcobjects.begin();
+			if (it == _gcobjects.end() || it->first > fenceValue)
+			{
+				break;
+			}
+
+			item = move(it->second);
+			_gcobjects.erase(it);
 		}
 
-		_gcobjects.pop();
+		// Item is processed without lock, so callback can add garbages.
 		switch (item.TypeIndex)
 		{
 		case 0:
 			item.IsUnknown->Release();
 			break;
 		case 1:
+		{
+			unique_lock lock(GetDevice()->GetSubobjectLock());
 			DestroySubobject(item.IsObject);
 			break;
 		}
+		case 2:
+			item.Callback();
+			break;
+		}
 
 		++count;
+		if (timeBudget.has_value() && steady_clock::now() - begin >= timeBudget.value())
+		{
+			break;
+		}
 	}
 
 	return count;
@@ -100,22 +155,37 @@ int32 RHICommandQueue::Collect()
 
 void RHICommandQueue::AddGarbageObject(uint64 fenceValue, Object* object)
 {
-	object->SetOuter(this);
+	// Subobject list of this queue is changed here and in Collect(), and subobject list of device is changed by resource creation on other threads.
+	{
+		unique_lock lock(GetDevice()->GetSubobjectLock());
+		object->SetOuter(this);
+	}
 
-	_gcobjects.emplace() =
+	unique_lock lock(_gclock);
+	_gcobjects.emplace(fenceValue, GarbageItem
 	{
 		.TypeIndex = 1,
-		.FenceValue = fenceValue,
 		.IsObject = object
-	};
+	});
+}
+
+void RHICommandQueue::AddCompletionCallback(uint64 fenceValue, function<void()> callback)
+{
+	unique_lock lock(_gclock);
+	_gcobjects.emplace(fenceValue, GarbageItem
+	{
+		.TypeIndex = 2,
+		.IsObject = nullptr,
+		.Callback = move(callback)
+	});
 }
 
 void RHICommandQueue::AddGarbageObject(uint64 fenceValue, IUnknown* unknown)
 {
-	_gcobjects.emplace() =
+	unique_lock lock(_gclock);
+	_gcobjects.emplace(fenceValue, GarbageItem
 	{
 		.TypeIndex = 0,
-		.FenceValue = fenceValue,
 		.IsUnknown = unknown
-	};
+	});
 }
\ No newline at end of file
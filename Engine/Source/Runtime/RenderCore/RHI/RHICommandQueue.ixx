@@ -8,14 +8,17 @@ import :ComPtr;
 import :RHIEnums;
 import :RHIDeviceChild;
 import std.core;
+import std.threading;
 
 export class RHIDevice;
 export class RHIDeviceContext;
 
 using namespace std;
+using namespace std::chrono;
 
 /// <summary>
 /// Provides methods for submitting command lists that written by device context, synchronizing device context execution.
+/// Each signal advances fence timeline of this queue, and garbages and callbacks are processed when GPU reaches their fence value.
 /// </summary>
 export class RHICommandQueue : public RHIDeviceChild
 {
@@ -26,20 +29,21 @@ private:
 	struct GarbageItem
 	{
 		int32 TypeIndex = 0;
-		uint64 FenceValue = 0;
 		union
 		{
 			IUnknown* IsUnknown;
 			Object* IsObject;
 		};
+		function<void()> Callback;
 	};
 
 private:
 	ComPtr<ID3D12CommandQueue> _queue;
 	ComPtr<ID3D12Fence> _fence;
 	atomic<uint64> _signalNumber = 0;
-	EventHandle* _fenceEvent = nullptr;
-	queue<GarbageItem> _gcobjects;
+	mutex _gclock;
+	mutex _submitLock;
+	multimap<uint64, GarbageItem> _gcobjects;
 
 public:
 	/// <summary>
@@ -57,7 +61,7 @@ public:
 	uint64 Signal();
 
 	/// <summary>
-	/// Wait for commands executed that represented by signal number.
+	/// Wait for commands executed that represented by signal number. Any past signal number can be waited, and multiple threads can wait concurrently.
 	/// </summary>
 	/// <param name="signalNumber"> The signal number. </param>
 	void WaitSignal(uint64 signalNumber);
@@ -67,6 +71,22 @@ public:
 	/// </summary>
 	void WaitLastSignal();
 
+	/// <summary>
+	/// Get the last signal number that commands are executed. Null device completes commands on signal.
+	/// </summary>
+	uint64 GetCompletedValue() const;
+
+	/// <summary>
+	/// Get the last signal number.
+	/// </summary>
+	uint64 GetLastSignalValue() const { return _signalNumber.load(); }
+
+	/// <summary>
+	/// Indicate commands that represented by signal number are executed. This does not block calling thread.
+	/// </summary>
+	/// <param name="signalNumber"> The signal number. </param>
+	bool IsComplete(uint64 signalNumber) const { return GetCompletedValue() >= signalNumber; }
+
 	/// <summary>
 	/// Execute a device context.
 	/// </summary>
@@ -78,6 +98,7 @@ public:
 
 	/// <summary>
 	/// Execute multiple device contexts.
+	/// Resource states that device contexts tracked are resolved in submission order, and resolve barriers are executed before each device context.
 	/// </summary>
 	uint64 ExecuteDeviceContexts(span<RHIDeviceContext*> deviceContexts);
 
@@ -92,17 +113,30 @@ public:
 	}
 
 	/// <summary>
-	/// Collect all registered garbages.
+	/// Collect registered garbages and invoke completion callbacks that GPU completed their fence value.
+	/// Collect is owned by single thread, game thread in engine. Garbages and callbacks can be added from any thread.
 	/// </summary>
+	/// <param name="timeBudget"> The time budget. Remaining items are processed on next call. nullopt to process all completed items. </param>
 	/// <returns> Count of collected items. </returns>
-	int32 Collect();
+	int32 Collect(optional<duration<float>> timeBudget = nullopt);
 
 	/// <summary>
 	/// Add garbage object. Object will destroy at Collect() called and outer will change to this object.
+	/// Outer is changed under subobject lock of device, so object can be added from any thread.
 	/// </summary>
 	void AddGarbageObject(uint64 fenceValue, Object* object);
 
+	/// <summary>
+	/// Add callback that invoked by Collect() after GPU completes fence value.
+	/// </summary>
+	/// <param name="fenceValue"> The fence value. </param>
+	/// <param name="callback"> The callback. </param>
+	void AddCompletionCallback(uint64 fenceValue, function<void()> callback);
+
 public /*internal*/:
 	ID3D12CommandQueue* GetCommandQueue() const { return _queue.Get(); }
 	void AddGarbageObject(uint64 fenceValue, IUnknown* unknown);
+
+private:
+	uint64 InternalSignal();
 };
\ No newline at end of file
@@ -0,0 +1,275 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+#include "Internal.h"
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+RHIDescriptorAllocator::RHIDescriptorAllocator(RHIDevice* device, RHICommandQueue* queue) : Super(device)
+	, _queue(queue)
+{
+	if (device->IsNullDevice())
+	{
+		// Null device have not descriptor heap. Handles are reserved in distinct range from CPU descriptor heaps.
+		_shaderVisibleCPUStart = 1ULL << 48;
+		_shaderVisibleGPUStart = 1ULL << 48;
+		_shaderVisibleIncrement = 1;
+		for (auto& group : _groups)
+		{
+			group.Increment = 1;
+		}
+		return;
+	}
+
+	ID3D12Device* dev = device->GetDevice();
+	for (size_t i = 0; i < NumHeapTypes; ++i)
+	{
+		_groups[i].Increment = dev->GetDescriptorHandleIncrementSize((D3D12_DESCRIPTOR_HEAP_TYPE)i);
+	}
+
+	D3D12_DESCRIPTOR_HEAP_DESC heapd =
+	{
+		.Type = D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV,
+		.NumDescriptors = ShaderVisibleDescriptors,
+		.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE
+	};
+	HR(LogRHI, dev->CreateDescriptorHeap(&heapd, IID_PPV_ARGS(&_shaderVisibleHeap)));
+	_shaderVisibleCPUStart = _shaderVisibleHeap->GetCPUDescriptorHandleForHeapStart().ptr;
+	_shaderVisibleGPUStart = _shaderVisibleHeap->GetGPUDescriptorHandleForHeapStart().ptr;
+	_shaderVisibleIncrement = _groups[(size_t)ERHIDescriptorHeapType::CBV_SRV_UAV].Increment;
+}
+
+RHIDescriptorAllocator::~RHIDescriptorAllocator()
+{
+}
+
+RHIDescriptorAllocation RHIDescriptorAllocator::Allocate(ERHIDescriptorHeapType type, uint32 count)
+{
+	if (count == 0 || count > DescriptorsPerHeap)
+	{
+		LogSystem::Log<Error>(LogRHI, L"Could not allocate {} descriptors. Count should be in range [1, {}].", count, DescriptorsPerHeap);
+		return {};
+	}
+
+	unique_lock lock(_lock);
+	HeapGroup& group = _groups[(size_t)type];
+
+	auto allocateFrom = [&](Heap& heap, uint32 heapIndex) -> RHIDescriptorAllocation
+	{
+		// First fit. Lower offsets are preferred, so free blocks are packed to front.
+		for (auto it = heap.FreeBlocks.begin(); it != heap.FreeBlocks.end(); ++it)
+		{
+			auto [offset, size] = *it;
+			if (size < count)
+			{
+				continue;
+			}
+
+			heap.FreeBlocks.erase(it);
+			if (size > count)
+			{
+				heap.FreeBlocks.emplace(offset + count, size - count);
+			}
+			heap.NumAllocated += count;
+
+			return
+			{
+				.Type = type,
+				.HeapIndex = heapIndex,
+				.Offset = offset,
+				.Count = count,
+				.CPUHandle = heap.CPUStart + (uint64)group.Increment * offset,
+				.Increment = group.Increment
+			};
+		}
+
+		return {};
+	};
+
+	for (size_t i = 0; i < group.Heaps.size(); ++i)
+	{
+		if (RHIDescriptorAllocation allocation = allocateFrom(group.Heaps[i], (uint32)i); allocation.IsValid())
+		{
+			return allocation;
+		}
+	}
+
+	// All heaps are full or fragmented. Add new heap.
+	Heap& heap = AddHeap(type);
+	return allocateFrom(heap, (uint32)group.Heaps.size() - 1);
+}
+
+void RHIDescriptorAllocator::Free(const RHIDescriptorAllocation& allocation)
+{
+	if (!allocation.IsValid())
+	{
+		return;
+	}
+
+	unique_lock lock(_lock);
+	HeapGroup& group = _groups[(size_t)allocation.Type];
+	if (allocation.HeapIndex >= group.Heaps.size())
+	{
+		LogSystem::Log<Error>(LogRHI, L"Descriptor allocation is not allocated from this allocator.");
+		return;
+	}
+
+	Heap& heap = group.Heaps[allocation.HeapIndex];
+	uint32 offset = allocation.Offset;
+	uint32 size = allocation.Count;
+
+	// Coalesce with adjacent free blocks.
+	auto next = heap.FreeBlocks.lower_bound(offset);
+	if (next != heap.FreeBlocks.end() && offset + size == next->first)
+	{
+		size += next->second;
+		next = heap.FreeBlocks.erase(next);
+	}
+
+	if (next != heap.FreeBlocks.begin())
+	{
+		auto prev = std::prev(next);
+		if (prev->first + prev->second == offset)
+		{
+			offset = prev->first;
+			size += prev->second;
+			heap.FreeBlocks.erase(prev);
+		}
+	}
+
+	heap.FreeBlocks.emplace(offset, size);
+	heap.NumAllocated -= allocation.Count;
+}
+
+RHIDescriptorAllocation RHIDescriptorAllocator::AllocateTransient(uint32 count)
+{
+	if (count == 0)
+	{
+		return {};
+	}
+
+	unique_lock lock(_lock);
+
+	for (int32 attempt = 0; attempt < 2; ++attempt)
+	{
+		uint32 offset = _head;
+		if ((uint64)offset + count > ShaderVisibleDescriptors)
+		{
+			// Descriptor table should be contiguous. Skip remaining space to end of heap and wrap around.
+			offset = 0;
+		}
+
+		uint64 padding = offset >= _head ? 0 : ShaderVisibleDescriptors - _head;
+		uint64 required = padding + count;
+
+		if (_totalAllocated - _totalReleased + required <= ShaderVisibleDescriptors)
+		{
+			_head = offset + count;
+			_totalAllocated += required;
+
+			return
+			{
+				.Type = ERHIDescriptorHeapType::CBV_SRV_UAV,
+				.HeapIndex = 0,
+				.Offset = offset,
+				.Count = count,
+				.CPUHandle = _shaderVisibleCPUStart + (uint64)_shaderVisibleIncrement * offset,
+				.GPUHandle = _shaderVisibleGPUStart + (uint64)_shaderVisibleIncrement * offset,
+				.Increment = _shaderVisibleIncrement
+			};
+		}
+
+		Reclaim();
+	}
+
+	LogSystem::Log<Error>(LogRHI, L"Shader visible descriptor heap is full. Could not allocate {} descriptors.", count);
+	return {};
+}
+
+void RHIDescriptorAllocator::RetireFrame(uint64 fenceValue)
+{
+	unique_lock lock(_lock);
+	_frames.emplace(FrameMarker{ .FenceValue = fenceValue, .AllocatedDescriptors = _totalAllocated });
+	Reclaim();
+}
+
+RHIDescriptorHeapStatistics RHIDescriptorAllocator::GetStatistics(ERHIDescriptorHeapType type)
+{
+	unique_lock lock(_lock);
+	HeapGroup& group = _groups[(size_t)type];
+
+	RHIDescriptorHeapStatistics stats;
+	for (auto& heap : group.Heaps)
+	{
+		stats.NumHeaps += 1;
+		stats.Capacity += DescriptorsPerHeap;
+		stats.NumAllocated += heap.NumAllocated;
+		stats.NumFreeBlocks += (uint32)heap.FreeBlocks.size();
+		for (auto& [offset, size] : heap.FreeBlocks)
+		{
+			stats.LargestFreeBlock = max(stats.LargestFreeBlock, size);
+		}
+	}
+
+	return stats;
+}
+
+RHIDescriptorHeapStatistics RHIDescriptorAllocator::GetTransientStatistics()
+{
+	unique_lock lock(_lock);
+	Reclaim();
+
+	uint32 numAllocated = (uint32)(_totalAllocated - _totalReleased);
+	return
+	{
+		.NumHeaps = 1,
+		.Capacity = ShaderVisibleDescriptors,
+		.NumAllocated = numAllocated,
+		.NumFreeBlocks = numAllocated < ShaderVisibleDescriptors ? 1u : 0u,
+		.LargestFreeBlock = ShaderVisibleDescriptors - numAllocated
+	};
+}
+
+auto RHIDescriptorAllocator::AddHeap(ERHIDescriptorHeapType type) -> Heap&
+{
+	HeapGroup& group = _groups[(size_t)type];
+	Heap& heap = group.Heaps.emplace_back();
+	heap.FreeBlocks.emplace(0, DescriptorsPerHeap);
+
+	if (ID3D12Device* dev = GetDevice()->GetDevice(); dev != nullptr)
+	{
+		D3D12_DESCRIPTOR_HEAP_DESC heapd =
+		{
+			.Type = (D3D12_DESCRIPTOR_HEAP_TYPE)type,
+			.NumDescriptors = DescriptorsPerHeap,
+			.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE
+		};
+		HR(LogRHI, dev->CreateDescriptorHeap(&heapd, IID_PPV_ARGS(&heap.DescriptorHeap)));
+		heap.CPUStart = heap.DescriptorHeap->GetCPUDescriptorHandleForHeapStart().ptr;
+	}
+	else
+	{
+		// Keep handles of null device distinct for each heap and type.
+		heap.CPUStart = ((uint64)type << 40) | ((uint64)group.Heaps.size() << 32);
+	}
+
+	LogSystem::Log<Verbose>(LogRHI, L"Descriptor heap({}) is added. Count of heaps: {}.", (int32)type, group.Heaps.size());
+	return heap;
+}
+
+void RHIDescriptorAllocator::Reclaim()
+{
+	// Transient descriptors are released in order, so releasing frame releases all descriptors before the marker.
+	uint64 completed = _queue->GetCompletedValue();
+	while (!_frames.empty() && _frames.front().FenceValue <= completed)
+	{
+		_totalReleased = max(_totalReleased, _frames.front().AllocatedDescriptors);
+		_frames.pop();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIDescriptorAllocator;
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore.Internal;
+import :ComPtr;
+import :RHIEnums;
+import :RHIDeviceChild;
+
+using namespace std;
+
+export class RHIDevice;
+export class RHICommandQueue;
+
+/// <summary>
+/// Represents contiguous range of descriptors that allocated by <see cref="RHIDescriptorAllocator"/>.
+/// </summary>
+export struct RHIDescriptorAllocation
+{
+	/// <summary>
+	/// The type of descriptor heap.
+	/// </summary>
+	ERHIDescriptorHeapType Type = ERHIDescriptorHeapType::CBV_SRV_UAV;
+
+	/// <summary>
+	/// The index of heap that allocated from.
+	/// </summary>
+	uint32 HeapIndex = 0;
+
+	/// <summary>
+	/// The offset of first descriptor in heap.
+	/// </summary>
+	uint32 Offset = 0;
+
+	/// <summary>
+	/// The count of descriptors.
+	/// </summary>
+	uint32 Count = 0;
+
+	/// <summary>
+	/// The CPU descriptor handle of first descriptor.
+	/// </summary>
+	uint64 CPUHandle = 0;
+
+	/// <summary>
+	/// The GPU descriptor handle of first descriptor. Zero if allocation is not shader visible.
+	/// </summary>
+	uint64 GPUHandle = 0;
+
+	/// <summary>
+	/// The size of each descriptor in handle space.
+	/// </summary>
+	uint32 Increment = 0;
+
+	/// <summary>
+	/// Indicate allocation is succeeded.
+	/// </summary>
+	bool IsValid() const { return Count != 0; }
+
+	/// <summary>
+	/// Get CPU descriptor handle of descriptor at index.
+	/// </summary>
+	uint64 GetCPUHandle(uint32 index) const { return CPUHandle + (uint64)Increment * index; }
+
+	/// <summary>
+	/// Get GPU descriptor handle of descriptor at index.
+	/// </summary>
+	uint64 GetGPUHandle(uint32 index) const { return GPUHandle + (uint64)Increment * index; }
+};
+
+/// <summary>
+/// Represents occupancy and fragmentation of descriptor heaps.
+/// </summary>
+export struct RHIDescriptorHeapStatistics
+{
+	/// <summary>
+	/// The count of descriptor heaps.
+	/// </summary>
+	uint32 NumHeaps = 0;
+
+	/// <summary>
+	/// The total count of descriptors of all heaps.
+	/// </summary>
+	uint32 Capacity = 0;
+
+	/// <summary>
+	/// The count of descriptors that in use.
+	/// </summary>
+	uint32 NumAllocated = 0;
+
+	/// <summary>
+	/// The count of free blocks.
+	/// </summary>
+	uint32 NumFreeBlocks = 0;
+
+	/// <summary>
+	/// The count of descriptors of largest free block.
+	/// </summary>
+	uint32 LargestFreeBlock = 0;
+
+	/// <summary>
+	/// Get ratio of descriptors that in use.
+	/// </summary>
+	float GetOccupancy() const { return Capacity != 0 ? (float)NumAllocated / Capacity : 0; }
+
+	/// <summary>
+	/// Get ratio of free descriptors that could not be allocated as one block. Zero if all free descriptors are contiguous.
+	/// </summary>
+	float GetFragmentation() const
+	{
+		uint32 numFree = Capacity - NumAllocated;
+		return numFree != 0 ? 1.0f - (float)LargestFreeBlock / numFree : 0;
+	}
+};
+
+/// <summary>
+/// Represents central allocator of descriptors.
+/// Persistent descriptors are allocated from CPU descriptor heaps with free list, and heap is added when heaps are full.
+/// Transient shader visible descriptors are allocated linearly from single shader visible heap, and recycled when GPU completes the frame.
+/// </summary>
+export class RHIDescriptorAllocator : public RHIDeviceChild
+{
+public:
+	using Super = RHIDeviceChild;
+
+	/// <summary>
+	/// The count of descriptors of each CPU descriptor heap.
+	/// </summary>
+	static constexpr uint32 DescriptorsPerHeap = 1024;
+
+	/// <summary>
+	/// The count of descriptors of shader visible heap.
+	/// </summary>
+	static constexpr uint32 ShaderVisibleDescriptors = 65536;
+
+	/// <summary>
+	/// The count of descriptor heap types.
+	/// </summary>
+	static constexpr size_t NumHeapTypes = 4;
+
+private:
+	struct Heap
+	{
+		ComPtr<ID3D12DescriptorHeap> DescriptorHeap;
+		uint64 CPUStart = 0;
+		map<uint32, uint32> FreeBlocks;
+		uint32 NumAllocated = 0;
+	};
+
+	struct HeapGroup
+	{
+		vector<Heap> Heaps;
+		uint32 Increment = 0;
+	};
+
+	struct FrameMarker
+	{
+		uint64 FenceValue = 0;
+		uint64 AllocatedDescriptors = 0;
+	};
+
+	RHICommandQueue* const _queue;
+
+	mutex _lock;
+	array<HeapGroup, NumHeapTypes> _groups;
+
+	ComPtr<ID3D12DescriptorHeap> _shaderVisibleHeap;
+	uint64 _shaderVisibleCPUStart = 0;
+	uint64 _shaderVisibleGPUStart = 0;
+	uint32 _shaderVisibleIncrement = 0;
+	uint32 _head = 0;
+	uint64 _totalAllocated = 0;
+	uint64 _totalReleased = 0;
+	queue<FrameMarker> _frames;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIDescriptorAllocator"/> instance.
+	/// </summary>
+	/// <param name="device"> The logical device. </param>
+	/// <param name="queue"> The command queue that frames are submitted. </param>
+	RHIDescriptorAllocator(RHIDevice* device, RHICommandQueue* queue);
+	~RHIDescriptorAllocator() override;
+
+	/// <summary>
+	/// Allocate persistent descriptors from CPU descriptor heap.
+	/// </summary>
+	/// <param name="type"> The type of descriptor heap. </param>
+	/// <param name="count"> The count of contiguous descriptors. </param>
+	/// <returns> The allocation. Allocation is invalid if count exceeds <see cref="DescriptorsPerHeap"/>. </returns>
+	RHIDescriptorAllocation Allocate(ERHIDescriptorHeapType type, uint32 count);
+
+	/// <summary>
+	/// Free persistent descriptors. Descriptors of CPU descriptor heap are read when commands are recorded, so they can be freed after recording.
+	/// </summary>
+	/// <param name="allocation"> The allocation. </param>
+	void Free(const RHIDescriptorAllocation& allocation);
+
+	/// <summary>
+	/// Allocate transient descriptors from shader visible heap. Allocation is valid until the frame that allocated is completed by GPU.
+	/// </summary>
+	/// <param name="count"> The count of contiguous descriptors. </param>
+	/// <returns> The allocation. Allocation is invalid if heap is full. </returns>
+	RHIDescriptorAllocation AllocateTransient(uint32 count);
+
+	/// <summary>
+	/// Register fence value that signaled after the frame is submitted. Transient descriptors that allocated before are recycled after fence value is completed.
+	/// </summary>
+	/// <param name="fenceValue"> The fence value. </param>
+	void RetireFrame(uint64 fenceValue);
+
+	/// <summary>
+	/// Get statistics of CPU descriptor heaps.
+	/// </summary>
+	/// <param name="type"> The type of descriptor heap. </param>
+	RHIDescriptorHeapStatistics GetStatistics(ERHIDescriptorHeapType type);
+
+	/// <summary>
+	/// Get statistics of shader visible heap. Transient descriptors are linear, so free space is reported as one block.
+	/// </summary>
+	RHIDescriptorHeapStatistics GetTransientStatistics();
+
+public /*internal*/:
+	ID3D12DescriptorHeap* GetShaderVisibleHeap() const { return _shaderVisibleHeap.Get(); }
+
+private:
+	Heap& AddHeap(ERHIDescriptorHeapType type);
+	void Reclaim();
+};
\ No newline at end of file
@@ -5,12 +5,22 @@
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
 import SC.Runtime.RenderCore.Internal;
+import std.core;
+
+using namespace std;
 
 using enum ELogVerbosity;
 
-RHIDevice::RHIDevice(bool bDebug) : Super()
+RHIDevice::RHIDevice(bool bDebug, ERHIDeviceType deviceType) : Super()
 	, _bDebug(bDebug)
+	, _deviceType(deviceType)
 {
+	if (deviceType == ERHIDeviceType::Null)
+	{
+		InitializeNull();
+		return;
+	}
+
 	if (bDebug)
 	{
 		InitializeDebug();
@@ -23,10 +33,22 @@ RHIDevice::RHIDevice(bool bDebug) : Super()
 
 RHIDevice::~RHIDevice()
 {
+	// Garbage objects are destroyed under subobject lock, so collect them before members of device are destroyed.
+	if (_queue != nullptr)
+	{
+		_queue->WaitLastSignal();
+		_queue->Collect();
+	}
 }
 
 RHIResource* RHIDevice::CreateImmutableBuffer(ERHIResourceStates initialState, const uint8* buffer, size_t length)
 {
+	_numUploadedBytes += length;
+	if (IsNullDevice())
+	{
+		return CreateLockedSubobject<RHIResource>(this, nullptr, length, initialState);
+	}
+
 	D3D12_RESOURCE_DESC bufferDesc = { };
 	bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
 	bufferDesc.Width = (UINT64)length;
@@ -53,29 +75,30 @@ RHIResource* RHIDevice::CreateImmutableBuffer(ERHIResourceStates initialState, c
 	memcpy(pData, buffer, length);
 	uploadHeap->Unmap(0, nullptr);
 
-	D3D12_RESOURCE_BARRIER barrier = { };
-	barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
-	barrier.Transition.pResource = resource.Get();
-	barrier.Transition.StateBefore = D3D12_RESOURCE_STATE_COPY_DEST;
-	barrier.Transition.StateAfter = (D3D12_RESOURCE_STATES)initialState;
+	RHIResource* immutableBuffer = CreateLockedSubobject<RHIResource>(this, resource.Get(), 0, ERHIResourceStates::CopyDest);
+	RHIResource* uploadBuffer = CreateLockedSubobject<RHIResource>(this, uploadHeap.Get(), 0, ERHIResourceStates::GENERIC_READ);
 
-	RHIDeviceContext* cmd = CreateSubobject<RHIDeviceContext>(this, ERHICommandType::Direct);
+	// Upload heap is already in copy source state. Transition to initial state is flushed at End().
+	RHIDeviceContext* cmd = CreateLockedSubobject<RHIDeviceContext>(this, ERHICommandType::Direct);
 	cmd->Begin();
-	ComPtr<ID3D12GraphicsCommandList> cmdlist;
-	HR(LogRHI, cmd->GetCommandList()->QueryInterface(IID_PPV_ARGS(&cmdlist)));
-	cmdlist->CopyResource(resource.Get(), uploadHeap.Get());
-	cmdlist->ResourceBarrier(1, &barrier);
+	cmd->CopyResource(immutableBuffer, uploadBuffer);
+	cmd->TransitionState(immutableBuffer, initialState);
 	cmd->End();
 
 	uint64 signalNumber = _queue->ExecuteDeviceContext(cmd);
-	_queue->AddGarbageObject(signalNumber, uploadHeap.Detach());
+	_queue->AddGarbageObject(signalNumber, uploadBuffer);
 	_queue->AddGarbageObject(signalNumber, cmd);
 
-	return CreateSubobject<RHIResource>(this, resource.Get());
+	return immutableBuffer;
 }
 
 RHIResource* RHIDevice::CreateDynamicBuffer(size_t length)
 {
+	if (IsNullDevice())
+	{
+		return CreateLockedSubobject<RHIResource>(this, nullptr, length, ERHIResourceStates::GENERIC_READ);
+	}
+
 	D3D12_RESOURCE_DESC bufferDesc =
 	{
 		.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
@@ -97,12 +120,121 @@ RHIResource* RHIDevice::CreateDynamicBuffer(size_t length)
 	ComPtr<ID3D12Resource> resource;
 	HR(LogRHI, _device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &bufferDesc, D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&resource)));
 
-	return CreateSubobject<RHIResource>(this, resource.Get());
+	return CreateLockedSubobject<RHIResource>(this, resource.Get(), 0, ERHIResourceStates::GENERIC_READ);
+}
+
+RHIResource* RHIDevice::CreateBuffer(uint64 length, ERHIResourceFlags flags, ERHIResourceStates initialState)
+{
+	if (IsNullDevice())
+	{
+		return CreateLockedSubobject<RHIResource>(this, nullptr, length, initialState);
+	}
+
+	D3D12_RESOURCE_DESC bufferDesc =
+	{
+		.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER,
+		.Width = (UINT64)length,
+		.Height = 1,
+		.DepthOrArraySize = 1,
+		.MipLevels = 1,
+		.Format = DXGI_FORMAT_UNKNOWN,
+		.SampleDesc = { 1, 0 },
+		.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR,
+		.Flags = (D3D12_RESOURCE_FLAGS)(flags & ERHIResourceFlags::AllowUnorderedAccess)
+	};
+
+	D3D12_HEAP_PROPERTIES heap =
+	{
+		.Type = D3D12_HEAP_TYPE_DEFAULT
+	};
+
+	ComPtr<ID3D12Resource> resource;
+	HR(LogRHI, _device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &bufferDesc, (D3D12_RESOURCE_STATES)initialState, nullptr, IID_PPV_ARGS(&resource)));
+
+	return CreateLockedSubobject<RHIResource>(this, resource.Get(), 0, initialState);
+}
+
+RHITexture2D* RHIDevice::CreateTexture2D(int32 width, int32 height, ERHIPixelFormat format, ERHIResourceFlags flags, ERHIResourceStates initialState)
+{
+	if (IsNullDevice())
+	{
+		return CreateLockedSubobject<RHITexture2D>(this, width, height, initialState);
+	}
+
+	D3D12_RESOURCE_DESC textureDesc =
+	{
+		.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D,
+		.Width = (UINT64)width,
+		.Height = (UINT)height,
+		.DepthOrArraySize = 1,
+		.MipLevels = 1,
+		.Format = (DXGI_FORMAT)format,
+		.SampleDesc = { 1, 0 },
+		.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN,
+		.Flags = (D3D12_RESOURCE_FLAGS)flags
+	};
+
+	D3D12_HEAP_PROPERTIES heap =
+	{
+		.Type = D3D12_HEAP_TYPE_DEFAULT
+	};
+
+	ComPtr<ID3D12Resource> resource;
+	HR(LogRHI, _device->CreateCommittedResource(&heap, D3D12_HEAP_FLAG_NONE, &textureDesc, (D3D12_RESOURCE_STATES)initialState, nullptr, IID_PPV_ARGS(&resource)));
+
+	return CreateLockedSubobject<RHITexture2D>(this, resource.Get(), initialState);
+}
+
+RHIDeviceStatistics RHIDevice::GetStatistics() const
+{
+	return
+	{
+		.NumCommands = _numCommands.load(),
+		.NumElidedCommands = _numElidedCommands.load(),
+		.NumDrawCalls = _numDrawCalls.load(),
+		.NumBarriers = _numBarriers.load(),
+		.NumElidedBarriers = _numElidedBarriers.load(),
+		.NumExecutedDeviceContexts = _numExecutedDeviceContexts.load(),
+		.NumPresents = _numPresents.load(),
+		.NumUploadedBytes = _numUploadedBytes.load()
+	};
+}
+
+void RHIDevice::ResetStatistics()
+{
+	_numCommands = 0;
+	_numElidedCommands = 0;
+	_numDrawCalls = 0;
+	_numBarriers = 0;
+	_numElidedBarriers = 0;
+	_numExecutedDeviceContexts = 0;
+	_numPresents = 0;
+	_numUploadedBytes = 0;
+}
+
+void RHIDevice::AccumulateStatistics(const RHIDeviceStatistics& statistics)
+{
+	_numCommands += statistics.NumCommands;
+	_numElidedCommands += statistics.NumElidedCommands;
+	_numDrawCalls += statistics.NumDrawCalls;
+	_numBarriers += statistics.NumBarriers;
+	_numElidedBarriers += statistics.NumElidedBarriers;
+	_numExecutedDeviceContexts += statistics.NumExecutedDeviceContexts;
+	_numPresents += statistics.NumPresents;
+	_numUploadedBytes += statistics.NumUploadedBytes;
+}
+
+uint64 RHIDevice::AllocateNullAddress(uint64 size)
+{
+	// Keep addresses aligned as placement of committed resources.
+	constexpr uint64 Alignment = 65536;
+	size = (max(size, (uint64)1) + Alignment - 1) & ~(Alignment - 1);
+	return Alignment + _nullAddress.fetch_add(size);
 }
 
 void RHIDevice::InitializeDebug()
 {
-	LogSystem::Log(LogRHI, Info, L"----- Initialize Direct3D 12 debug layer.");
+	LogSystem::Log<Info>(LogRHI, L"----- Initialize Direct3D 12 debug layer.");
 
 	if (ComPtr<ID3D12Debug> debug; SUCCEEDED(D3D12GetDebugInterface(IID_PPV_ARGS(&debug))))
 	{
@@ -110,40 +242,40 @@ void RHIDevice::InitializeDebug()
 	}
 	else
 	{
-		LogSystem::Log(LogRHI, Warning, L"Direct3D 12 debug layer could not be enabled.");
+		LogSystem::Log<Warning>(LogRHI, L"Direct3D 12 debug layer could not be enabled.");
 	}
 
-	LogSystem::Log(LogRHI, Info, L"----- Done!");
+	LogSystem::Log<Info>(LogRHI, L"----- Done!");
 }
 
 void RHIDevice::InitializeCOM()
 {
-	LogSystem::Log(LogRHI, Info, L"----- Initialize COM subsystem.");
+	LogSystem::Log<Info>(LogRHI, L"----- Initialize COM subsystem.");
 
 	HR(LogRHI, CoInitializeEx(nullptr, COINIT::COINIT_MULTITHREADED));
-	LogSystem::Log(LogRHI, Info, L"COM initialized.");
+	LogSystem::Log<Info>(LogRHI, L"COM initialized.");
 
-	LogSystem::Log(LogRHI, Info, L"----- Done!");
+	LogSystem::Log<Info>(LogRHI, L"----- Done!");
 }
 
 void RHIDevice::InitializeDXGI()
 {
-	LogSystem::Log(LogRHI, Info, L"----- Initialize DXGI subsystem.");
+	LogSystem::Log<Info>(LogRHI, L"----- Initialize DXGI subsystem.");
 
 	uint32 flags = _bDebug ? DXGI_CREATE_FACTORY_DEBUG : 0;
 	HR(LogRHI, CreateDXGIFactory2(flags, IID_PPV_ARGS(&_factory)));
-	LogSystem::Log(LogRHI, Info, L"DXGI factory created.");
+	LogSystem::Log<Info>(LogRHI, L"DXGI factory created.");
 
-	LogSystem::Log(LogRHI, Info, L"----- Done!");
+	LogSystem::Log<Info>(LogRHI, L"----- Done!");
 }
 
 void RHIDevice::InitializeD3D12()
 {
 	constexpr double InvGiB = 1.0 / 1024.0 / 1024.0 / 1024.0;
 
-	LogSystem::Log(LogRHI, Info, L"----- Initialize D3D12 subsystem.");
+	LogSystem::Log<Info>(LogRHI, L"----- Initialize D3D12 subsystem.");
 
-	LogSystem::Log(LogRHI, Info, L"Finding most suitable physical device.");
+	LogSystem::Log<Info>(LogRHI, L"Finding most suitable physical device.");
 	ComPtr<IDXGIAdapter1> adapter;
 	for (int32 i = 0; SUCCEEDED(_factory->EnumAdapters1((uint32)i, &adapter)); ++i)
 	{
@@ -160,19 +292,35 @@ void RHIDevice::InitializeD3D12()
 			continue;
 		}
 
-		LogSystem::Log(LogRHI, Info, L"Suitable adapter found. Adapter: {}, VideoMemory: {:.2} GiB", desc.Description, desc.DedicatedVideoMemory * InvGiB);
+		LogSystem::Log<Info>(LogRHI, L"Suitable adapter found. Adapter: {}, VideoMemory: {:.2} GiB", desc.Description, desc.DedicatedVideoMemory * InvGiB);
 		break;
 	}
 
 	if (!adapter.IsSet())
 	{
-		LogSystem::Log(LogRHI, Fatal, L"Could not find suitable physical device.");
+		LogSystem::Log<Fatal>(LogRHI, L"Could not find suitable physical device.");
 		return;
 	}
 
 	HR(LogRHI, D3D12CreateDevice(adapter.Get(), D3D_FEATURE_LEVEL_11_0, IID_PPV_ARGS(&_device)));
 	_queue = CreateSubobject<RHICommandQueue>(this, ERHICommandType::Direct);
-	LogSystem::Log(LogRHI, Info, L"Direct3D 12 device created with feature level 11_0.");
+	_uploadRingBuffer = CreateSubobject<RHIUploadRingBuffer>(this, _queue, UploadRingBufferSize);
+	_pipelineStateCache = CreateSubobject<RHIPipelineStateCache>(this);
+	_descriptorAllocator = CreateSubobject<RHIDescriptorAllocator>(this, _queue);
+	LogSystem::Log<Info>(LogRHI, L"Direct3D 12 device created with feature level 11_0.");
+
+	LogSystem::Log<Info>(LogRHI, L"----- Done!");
+}
+
+void RHIDevice::InitializeNull()
+{
+	LogSystem::Log<Info>(LogRHI, L"----- Initialize null RHI device.");
+
+	_queue = CreateSubobject<RHICommandQueue>(this, ERHICommandType::Direct);
+	_uploadRingBuffer = CreateSubobject<RHIUploadRingBuffer>(this, _queue, UploadRingBufferSize);
+	_pipelineStateCache = CreateSubobject<RHIPipelineStateCache>(this);
+	_descriptorAllocator = CreateSubobject<RHIDescriptorAllocator>(this, _queue);
+	LogSystem::Log<Info>(LogRHI, L"Null device created. Commands will be counted and discarded.");
 
-	LogSystem::Log(LogRHI, Info, L"----- Done!");
+	LogSystem::Log<Info>(LogRHI, L"----- Done!");
 }
\ No newline at end of file
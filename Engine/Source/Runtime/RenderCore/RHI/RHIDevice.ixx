@@ -7,11 +7,20 @@ import SC.Runtime.RenderCore.Internal;
 import :LogRHI;
 import :ComPtr;
 import :RHIEnums;
+import :RHIStructures;
+import std.core;
+import std.threading;
+
+using namespace std;
 
 using enum ELogVerbosity;
 
 export class RHIResource;
+export class RHITexture2D;
 export class RHICommandQueue;
+export class RHIUploadRingBuffer;
+export class RHIPipelineStateCache;
+export class RHIDescriptorAllocator;
 
 /// <summary>
 /// Provide interface for control all render devices.
@@ -21,18 +30,40 @@ export class RHIDevice : virtual public Object
 public:
 	using Super = Object;
 
+	/// <summary>
+	/// The size of upload ring buffer that device owns.
+	/// </summary>
+	static constexpr uint64 UploadRingBufferSize = 16 * 1024 * 1024;
+
 private:
 	const uint8 _bDebug : 1;
+	const ERHIDeviceType _deviceType;
 
 	ComPtr<IDXGIFactory2> _factory;
 	ComPtr<ID3D12Device> _device;
 	RHICommandQueue* _queue = nullptr;
+	RHIUploadRingBuffer* _uploadRingBuffer = nullptr;
+	RHIPipelineStateCache* _pipelineStateCache = nullptr;
+	RHIDescriptorAllocator* _descriptorAllocator = nullptr;
+	recursive_mutex _subobjectLock;
+
+	atomic<uint64> _numCommands = 0;
+	atomic<uint64> _numElidedCommands = 0;
+	atomic<uint64> _numDrawCalls = 0;
+	atomic<uint64> _numBarriers = 0;
+	atomic<uint64> _numElidedBarriers = 0;
+	atomic<uint64> _numExecutedDeviceContexts = 0;
+	atomic<uint64> _numPresents = 0;
+	atomic<uint64> _numUploadedBytes = 0;
+	atomic<uint64> _nullAddress = 0;
 
 public:
 	/// <summary>
 	/// Initialize new <see cref="RHIDevice"/> instance.
 	/// </summary>
-	RHIDevice(bool bDebug = false);
+	/// <param name="bDebug"> Enable debug layer. </param>
+	/// <param name="deviceType"> The backend of device. </param>
+	RHIDevice(bool bDebug = false, ERHIDeviceType deviceType = ERHIDeviceType::D3D12);
 	~RHIDevice() override;
 
 	/// <summary>
@@ -40,6 +71,21 @@ public:
 	/// </summary>
 	RHICommandQueue* GetPrimaryQueue() const { return _queue; }
 
+	/// <summary>
+	/// Get upload ring buffer that allocate transient data of frames submitted to primary queue.
+	/// </summary>
+	RHIUploadRingBuffer* GetUploadRingBuffer() const { return _uploadRingBuffer; }
+
+	/// <summary>
+	/// Get cache of root signatures and pipeline states.
+	/// </summary>
+	RHIPipelineStateCache* GetPipelineStateCache() const { return _pipelineStateCache; }
+
+	/// <summary>
+	/// Get allocator of descriptors that all views are allocated from.
+	/// </summary>
+	RHIDescriptorAllocator* GetDescriptorAllocator() const { return _descriptorAllocator; }
+
 	/// <summary>
 	/// Create immutable buffer.
 	/// </summary>
@@ -50,13 +96,67 @@ public:
 	/// </summary>
 	RHIResource* CreateDynamicBuffer(size_t length);
 
+	/// <summary>
+	/// Create buffer that placed on GPU local memory.
+	/// </summary>
+	/// <param name="length"> The size of buffer in bytes. </param>
+	/// <param name="flags"> The usages that must be allowed. </param>
+	/// <param name="initialState"> The state that buffer is created with. </param>
+	RHIResource* CreateBuffer(uint64 length, ERHIResourceFlags flags, ERHIResourceStates initialState);
+
+	/// <summary>
+	/// Create 2D texture that placed on GPU local memory.
+	/// </summary>
+	/// <param name="width"> The width of texture. </param>
+	/// <param name="height"> The height of texture. </param>
+	/// <param name="format"> The pixel format. </param>
+	/// <param name="flags"> The usages that must be allowed. </param>
+	/// <param name="initialState"> The state that texture is created with. </param>
+	RHITexture2D* CreateTexture2D(int32 width, int32 height, ERHIPixelFormat format, ERHIResourceFlags flags, ERHIResourceStates initialState);
+
+	/// <summary>
+	/// Get backend of this device.
+	/// </summary>
+	ERHIDeviceType GetDeviceType() const { return _deviceType; }
+
+	/// <summary>
+	/// Indicate this device is null device that does not use GPU.
+	/// </summary>
+	bool IsNullDevice() const { return _deviceType == ERHIDeviceType::Null; }
+
+	/// <summary>
+	/// Get counts of commands that recorded and submitted since created or reset.
+	/// </summary>
+	RHIDeviceStatistics GetStatistics() const;
+
+	/// <summary>
+	/// Reset counts of commands.
+	/// </summary>
+	void ResetStatistics();
+
 public /*internal*/ :
 	IDXGIFactory2* GetFactory() const { return _factory.Get(); }
 	ID3D12Device* GetDevice() const { return _device.Get(); }
+	void AccumulateStatistics(const RHIDeviceStatistics& statistics);
+	uint64 AllocateNullAddress(uint64 size);
+
+	/// <summary>
+	/// Get lock that guards subobject lists of device and its primary queue.
+	/// Resources are created on game and render threads, and garbages are moved to queue and destroyed by collecting thread.
+	/// </summary>
+	recursive_mutex& GetSubobjectLock() { return _subobjectLock; }
 
 private:
+	template<class T, class... TArgs>
+	T* CreateLockedSubobject(TArgs&&... args)
+	{
+		unique_lock lock(_subobjectLock);
+		return CreateSubobject<T>(forward<TArgs>(args)...);
+	}
+
 	void InitializeDebug();
 	void InitializeCOM();
 	void InitializeDXGI();
 	void InitializeD3D12();
+	void InitializeNull();
 };
\ No newline at end of file
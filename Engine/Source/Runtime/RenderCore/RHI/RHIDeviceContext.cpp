@@ -8,9 +8,48 @@ import SC.Runtime.Core;
 
 using namespace std;
 
+namespace
+{
+	bool IsStateCompatible(ERHIResourceStates current, ERHIResourceStates desired)
+	{
+		// Combined read state includes each read state. Write states are exclusive, so they are compatible only if equal.
+		return current == desired || (desired != ERHIResourceStates::Common && (current & desired) == desired);
+	}
+
+	void RecordBarriers(ID3D12GraphicsCommandList* commandList, span<const RHITransitionBarrier> barriers)
+	{
+		vector<D3D12_RESOURCE_BARRIER> d3dbars(barriers.size());
+		for (size_t i = 0; i < barriers.size(); ++i)
+		{
+			auto& barrier = barriers[i];
+
+			d3dbars[i] =
+			{
+				.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
+				.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
+				.Transition =
+				{
+					.pResource = barrier.Resource->GetResource(),
+					.Subresource = barrier.SubresourceIndex,
+					.StateBefore = (D3D12_RESOURCE_STATES)barrier.StateBefore,
+					.StateAfter = (D3D12_RESOURCE_STATES)barrier.StateAfter
+				}
+			};
+		}
+
+		commandList->ResourceBarrier((UINT)d3dbars.size(), d3dbars.data());
+	}
+}
+
 RHIDeviceContext::RHIDeviceContext(RHIDevice* device, ERHICommandType commandType) : Super(device)
 	, _type(commandType)
+	, _bNullDevice(device->IsNullDevice())
 {
+	if (_bNullDevice)
+	{
+		return;
+	}
+
 	ID3D12Device* d3ddev = device->GetDevice();
 	HR(LogRHI, d3ddev->CreateCommandAllocator((D3D12_COMMAND_LIST_TYPE)commandType, IID_PPV_ARGS(&_allocator)));
 }
@@ -21,7 +60,22 @@ RHIDeviceContext::~RHIDeviceContext()
 
 void RHIDeviceContext::Begin()
 {
+	// Reset command list clears all states.
+	_statistics = {};
+	_pendingBarriers.clear();
+	_trackedResources.clear();
+	_initialTransitions.clear();
+	InvalidateStates();
+	if (_bNullDevice)
+	{
+		return;
+	}
+
 	HR_E(LogRHI, _allocator->Reset());
+	if (_resolveAllocator)
+	{
+		HR_E(LogRHI, _resolveAllocator->Reset());
+	}
 
 	if (_commandList)
 	{
@@ -36,89 +90,355 @@ void RHIDeviceContext::Begin()
 
 void RHIDeviceContext::End()
 {
+	FlushBarriers();
+	GetDevice()->AccumulateStatistics(_statistics);
+	if (_bNullDevice)
+	{
+		return;
+	}
+
 	HR_E(LogRHI, _commandList->Close());
 }
 
 void RHIDeviceContext::DrawIndexedInstanced(uint32 indexCountPerInstance, uint32 instanceCount, uint32 startIndexLocation, int32 baseVertexLocation, uint32 startInstanceLocation)
 {
-	_commandList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	FlushBarriers();
+	if (RecordCommand(instanceCount != 0 ? 1 : 0))
+	{
+		_commandList->DrawIndexedInstanced(indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation);
+	}
 }
 
 void RHIDeviceContext::DrawInstanced(uint32 vertexCountPerInstance, uint32 instanceCount, int32 baseVertexLocation, uint32 startInstanceLocation)
 {
-	_commandList->DrawInstanced(vertexCountPerInstance, instanceCount, baseVertexLocation, startInstanceLocation);
+	FlushBarriers();
+	if (RecordCommand(instanceCount != 0 ? 1 : 0))
+	{
+		_commandList->DrawInstanced(vertexCountPerInstance, instanceCount, baseVertexLocation, startInstanceLocation);
+	}
 }
 
 void RHIDeviceContext::IASetPrimitiveTopology(ERHIPrimitiveTopology topology)
 {
-	_commandList->IASetPrimitiveTopology((D3D_PRIMITIVE_TOPOLOGY)topology);
+	if (_shadow.Topology == topology)
+	{
+		ElideCommand();
+		return;
+	}
+
+	_shadow.Topology = topology;
+	if (RecordCommand())
+	{
+		_commandList->IASetPrimitiveTopology((D3D_PRIMITIVE_TOPOLOGY)topology);
+	}
 }
 
 void RHIDeviceContext::SetGraphicsShader(RHIShader* shader)
 {
-	_commandList->SetGraphicsRootSignature(shader->GetRootSignature());
-	_commandList->SetPipelineState(shader->GetPipelineState());
+	ID3D12RootSignature* rootSignature = shader->GetRootSignature();
+	ID3D12PipelineState* pipelineState = shader->GetPipelineState();
+
+	// Shaders that share pipeline by cache are also redundant. Null device have not pipeline, so compare shader itself.
+	bool bSameRootSignature = _shadow.Shader != nullptr && _shadow.RootSignature == rootSignature;
+	bool bSamePipelineState = _shadow.Shader != nullptr && _shadow.PipelineState == pipelineState;
+	if (bSameRootSignature && bSamePipelineState && (pipelineState != nullptr || _shadow.Shader == shader))
+	{
+		ElideCommand();
+		return;
+	}
+
+	_shadow.Shader = shader;
+	_shadow.RootSignature = rootSignature;
+	_shadow.PipelineState = pipelineState;
+	if (RecordCommand())
+	{
+		// Setting root signature invalidates all root arguments. Keep them if root signature is not changed.
+		if (!bSameRootSignature)
+		{
+			_commandList->SetGraphicsRootSignature(rootSignature);
+		}
+
+		if (!bSamePipelineState)
+		{
+			_commandList->SetPipelineState(pipelineState);
+		}
+	}
 }
 
 void RHIDeviceContext::OMSetRenderTargets(RHIRenderTargetView* rtv)
 {
-	D3D12_CPU_DESCRIPTOR_HANDLE handle = rtv->GetCPUDescriptorHandle();
-	_commandList->OMSetRenderTargets(rtv->GetDescriptorCount(), &handle, 0, nullptr);
+	OMSetRenderTargets(rtv, 0, rtv->GetDescriptorCount());
 }
 
 void RHIDeviceContext::OMSetRenderTargets(RHIRenderTargetView* rtv, int32 index, int32 count)
 {
-	D3D12_CPU_DESCRIPTOR_HANDLE handle = rtv->GetCPUDescriptorHandle(index);
-	_commandList->OMSetRenderTargets(count, &handle, 0, nullptr);
+	for (int32 i = 0; i < count; ++i)
+	{
+		if (RHITexture2D* texture = rtv->GetTexture(index + i); texture != nullptr)
+		{
+			TransitionState(texture, ERHIResourceStates::RenderTarget);
+		}
+	}
+
+	if (_shadow.RenderTargetView == rtv && _shadow.RenderTargetIndex == index && _shadow.RenderTargetCount == count)
+	{
+		ElideCommand();
+		return;
+	}
+
+	_shadow.RenderTargetView = rtv;
+	_shadow.RenderTargetIndex = index;
+	_shadow.RenderTargetCount = count;
+	if (RecordCommand())
+	{
+		// Descriptors of render target view are contiguous.
+		D3D12_CPU_DESCRIPTOR_HANDLE handle = rtv->GetCPUDescriptorHandle(index);
+		_commandList->OMSetRenderTargets(count, &handle, TRUE, nullptr);
+	}
 }
 
 void RHIDeviceContext::ClearRenderTargetView(RHIRenderTargetView* rtv, const Color& color)
 {
-	_commandList->ClearRenderTargetView(rtv->GetCPUDescriptorHandle(), (const FLOAT*)&color, 0, nullptr);
+	ClearRenderTargetView(rtv, 0, color);
 }
 
 void RHIDeviceContext::ClearRenderTargetView(RHIRenderTargetView* rtv, int32 index, const Color& color)
 {
-	_commandList->ClearRenderTargetView(rtv->GetCPUDescriptorHandle(index), (const FLOAT*)&color, 0, nullptr);
+	if (RHITexture2D* texture = rtv->GetTexture(index); texture != nullptr)
+	{
+		TransitionState(texture, ERHIResourceStates::RenderTarget);
+	}
+
+	FlushBarriers();
+	if (RecordCommand())
+	{
+		_commandList->ClearRenderTargetView(rtv->GetCPUDescriptorHandle(index), (const FLOAT*)&color, 0, nullptr);
+	}
 }
 
 void RHIDeviceContext::RSSetScissorRects(int32 count, const RHIScissorRect* rects)
 {
-	_commandList->RSSetScissorRects((UINT)count, (const D3D12_RECT*)rects);
+	if (_shadow.ScissorRects.has_value() && equal(_shadow.ScissorRects->begin(), _shadow.ScissorRects->end(), rects, rects + count))
+	{
+		ElideCommand();
+		return;
+	}
+
+	_shadow.ScissorRects.emplace(rects, rects + count);
+	if (RecordCommand())
+	{
+		_commandList->RSSetScissorRects((UINT)count, (const D3D12_RECT*)rects);
+	}
 }
 
 void RHIDeviceContext::RSSetViewports(int32 count, const RHIViewport* viewports)
 {
-	_commandList->RSSetViewports((UINT)count, (const D3D12_VIEWPORT*)viewports);
+	if (_shadow.Viewports.has_value() && equal(_shadow.Viewports->begin(), _shadow.Viewports->end(), viewports, viewports + count))
+	{
+		ElideCommand();
+		return;
+	}
+
+	_shadow.Viewports.emplace(viewports, viewports + count);
+	if (RecordCommand())
+	{
+		_commandList->RSSetViewports((UINT)count, (const D3D12_VIEWPORT*)viewports);
+	}
 }
 
 void RHIDeviceContext::TransitionBarrier(int32 count, const RHITransitionBarrier* barriers)
 {
-	vector<D3D12_RESOURCE_BARRIER> d3dbars(count);
+	FlushBarriers();
 	for (int32 i = 0; i < count; ++i)
 	{
 		auto& barrier = barriers[i];
+		TrackedResource& tracked = _trackedResources[barrier.Resource];
 
-		d3dbars[i] =
+		uint32 firstSubresource = 0;
+		span<optional<ERHIResourceStates>> locals = GetLocalStates(barrier.Resource, tracked, barrier.SubresourceIndex, firstSubresource);
+		for (size_t j = 0; j < locals.size(); ++j)
 		{
-			.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION,
-			.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE,
-			.Transition =
+			if (!locals[j].has_value())
 			{
-				.pResource = barrier.Resource->GetResource(),
-				.Subresource = barrier.SubresourceIndex,
-				.StateBefore = (D3D12_RESOURCE_STATES)barrier.StateBefore,
-				.StateAfter = (D3D12_RESOURCE_STATES)barrier.StateAfter
+				// Barrier expects resource is in state before. Queue resolves it at submission.
+				_initialTransitions.emplace_back(RHITransitionBarrier
+				{
+					.Resource = barrier.Resource,
+					.StateAfter = barrier.StateBefore,
+					.SubresourceIndex = firstSubresource == RHIResource::AllSubresources ? firstSubresource : firstSubresource + (uint32)j
+				});
 			}
-		};
+
+			locals[j] = barrier.StateAfter;
+		}
+
+		tracked.bTransitioned = true;
+		CollapseLocalStates(tracked);
 	}
 
-	_commandList->ResourceBarrier(count, d3dbars.data());
+	if (RecordCommand(0, (uint64)count))
+	{
+		RecordBarriers(_commandList.Get(), span(barriers, (size_t)count));
+	}
+}
+
+void RHIDeviceContext::TransitionState(RHIResource* resource, ERHIResourceStates state, uint32 subresource)
+{
+	TrackedResource& tracked = _trackedResources[resource];
+
+	// Subresources that are in different states are transitioned from their own states.
+	uint32 firstSubresource = 0;
+	span<optional<ERHIResourceStates>> locals = GetLocalStates(resource, tracked, subresource, firstSubresource);
+	for (size_t i = 0; i < locals.size(); ++i)
+	{
+		uint32 index = firstSubresource == RHIResource::AllSubresources ? firstSubresource : firstSubresource + (uint32)i;
+		TransitionSubresource(resource, tracked, locals[i], state, index);
+	}
+
+	CollapseLocalStates(tracked);
+}
+
+void RHIDeviceContext::FlushBarriers()
+{
+	if (_pendingBarriers.empty())
+	{
+		return;
+	}
+
+	if (RecordCommand(0, (uint64)_pendingBarriers.size()))
+	{
+		RecordBarriers(_commandList.Get(), _pendingBarriers);
+	}
+
+	_pendingBarriers.clear();
+}
+
+void RHIDeviceContext::CopyResource(RHIResource* dstResource, RHIResource* srcResource)
+{
+	TransitionState(dstResource, ERHIResourceStates::CopyDest);
+	TransitionState(srcResource, ERHIResourceStates::CopySource);
+	FlushBarriers();
+
+	if (RecordCommand())
+	{
+		_commandList->CopyResource(dstResource->GetResource(), srcResource->GetResource());
+	}
 }
 
 void RHIDeviceContext::IASetVertexBuffers(uint32 startSlot, uint32 numViews, const RHIVertexBufferView* views)
 {
-	_commandList->IASetVertexBuffers(startSlot, numViews, (const D3D12_VERTEX_BUFFER_VIEW*)views);
+	if (numViews == 0 || startSlot + numViews > MaxVertexBufferSlots)
+	{
+		// Out of shadowed range. Record command as is.
+		if (RecordCommand())
+		{
+			_commandList->IASetVertexBuffers(startSlot, numViews, (const D3D12_VERTEX_BUFFER_VIEW*)views);
+		}
+		return;
+	}
+
+	// Null views unbind slots. Find changed range of slots, and set that range only.
+	auto viewAt = [views](uint32 i) { return views != nullptr ? views[i] : RHIVertexBufferView(); };
+	optional<uint32> first;
+	uint32 last = 0;
+	for (uint32 i = 0; i < numViews; ++i)
+	{
+		uint32 slot = startSlot + i;
+		RHIVertexBufferView view = viewAt(i);
+		if ((_shadow.VertexBufferMask & (1u << slot)) == 0 || _shadow.VertexBuffers[slot] != view)
+		{
+			_shadow.VertexBuffers[slot] = view;
+			_shadow.VertexBufferMask |= 1u << slot;
+			first = first.value_or(i);
+			last = i;
+		}
+	}
+
+	if (!first.has_value())
+	{
+		ElideCommand();
+		return;
+	}
+
+	if (RecordCommand())
+	{
+		const RHIVertexBufferView* changed = views != nullptr ? views + *first : nullptr;
+		_commandList->IASetVertexBuffers(startSlot + *first, last - *first + 1, (const D3D12_VERTEX_BUFFER_VIEW*)changed);
+	}
+}
+
+void RHIDeviceContext::InvalidateStates()
+{
+	_shadow = {};
+}
+
+ID3D12CommandList* RHIDeviceContext::ResolveResourceStates()
+{
+	// Resource that this context only reads in compatible state can stay in current state, since no recorded barrier assumes otherwise.
+	auto canKeepState = [](const TrackedResource& tracked, optional<ERHIResourceStates> current, ERHIResourceStates local)
+	{
+		return current.has_value() && (*current == local || (!tracked.bTransitioned && IsStateCompatible(*current, local)));
+	};
+
+	vector<RHITransitionBarrier> barriers;
+	for (auto& initial : _initialTransitions)
+	{
+		RHIResource* resource = initial.Resource;
+		const TrackedResource& tracked = _trackedResources[resource];
+
+		if (optional<ERHIResourceStates> current = resource->GetState(initial.SubresourceIndex); current.has_value())
+		{
+			if (!canKeepState(tracked, current, initial.StateAfter))
+			{
+				barriers.emplace_back(RHITransitionBarrier
+				{
+					.Resource = resource,
+					.StateBefore = *current,
+					.StateAfter = initial.StateAfter,
+					.SubresourceIndex = initial.SubresourceIndex
+				});
+			}
+			continue;
+		}
+
+		for (uint32 i = 0; i < resource->GetNumSubresources(); ++i)
+		{
+			ERHIResourceStates current = resource->GetState(i).value();
+			if (current != initial.StateAfter)
+			{
+				barriers.emplace_back(RHITransitionBarrier
+				{
+					.Resource = resource,
+					.StateBefore = current,
+					.StateAfter = initial.StateAfter,
+					.SubresourceIndex = i
+				});
+			}
+		}
+	}
+
+	// Commit final states of this context, so next submitted context is resolved from them.
+	for (auto& [resource, tracked] : _trackedResources)
+	{
+		if (tracked.SubresourceStates.empty())
+		{
+			if (tracked.State.has_value() && !canKeepState(tracked, resource->GetState(), *tracked.State))
+			{
+				resource->SetState(RHIResource::AllSubresources, *tracked.State);
+			}
+			continue;
+		}
+
+		for (uint32 i = 0; i < (uint32)tracked.SubresourceStates.size(); ++i)
+		{
+			if (auto& local = tracked.SubresourceStates[i]; local.has_value() && !canKeepState(tracked, resource->GetState(i), *local))
+			{
+				resource->SetState(i, *local);
+			}
+		}
+	}
+
+	return RecordResolveBarriers(barriers);
 }
 
 void RHIDeviceContext::SwapAllocator(ComPtr<ID3D12CommandAllocator>&& swap)
@@ -126,4 +446,163 @@ void RHIDeviceContext::SwapAllocator(ComPtr<ID3D12CommandAllocator>&& swap)
 	ComPtr<ID3D12CommandAllocator> t = move(_allocator);
 	_allocator = move(swap);
 	swap = move(t);
+}
+
+bool RHIDeviceContext::RecordCommand(uint64 numDrawCalls, uint64 numBarriers)
+{
+	_statistics.NumCommands += 1;
+	_statistics.NumDrawCalls += numDrawCalls;
+	_statistics.NumBarriers += numBarriers;
+
+	// Null device discards commands after counting.
+	return !_bNullDevice;
+}
+
+void RHIDeviceContext::ElideCommand()
+{
+	_statistics.NumElidedCommands += 1;
+}
+
+span<optional<ERHIResourceStates>> RHIDeviceContext::GetLocalStates(RHIResource* resource, TrackedResource& tracked, uint32 subresource, uint32& firstSubresource)
+{
+	uint32 numSubresources = resource->GetNumSubresources();
+	if (subresource == RHIResource::AllSubresources || numSubresources == 1)
+	{
+		if (tracked.SubresourceStates.empty())
+		{
+			firstSubresource = RHIResource::AllSubresources;
+			return span(&tracked.State, 1);
+		}
+
+		firstSubresource = 0;
+		return tracked.SubresourceStates;
+	}
+
+	// Expand uniform state to per subresource states.
+	if (tracked.SubresourceStates.empty())
+	{
+		tracked.SubresourceStates.resize(numSubresources, tracked.State);
+	}
+
+	firstSubresource = subresource;
+	return span(&tracked.SubresourceStates[subresource], 1);
+}
+
+void RHIDeviceContext::CollapseLocalStates(TrackedResource& tracked)
+{
+	if (tracked.SubresourceStates.empty())
+	{
+		return;
+	}
+
+	auto& first = tracked.SubresourceStates.front();
+	if (first.has_value() && all_of(tracked.SubresourceStates.begin(), tracked.SubresourceStates.end(), [&first](auto& state) { return state == first; }))
+	{
+		tracked.State = first;
+		tracked.SubresourceStates.clear();
+	}
+}
+
+void RHIDeviceContext::TransitionSubresource(RHIResource* resource, TrackedResource& tracked, optional<ERHIResourceStates>& local, ERHIResourceStates state, uint32 subresource)
+{
+	if (!local.has_value())
+	{
+		// First use of subresource in this context. Transition from state at submission is resolved by queue.
+		_initialTransitions.emplace_back(RHITransitionBarrier
+		{
+			.Resource = resource,
+			.StateAfter = state,
+			.SubresourceIndex = subresource
+		});
+		local = state;
+		return;
+	}
+
+	if (IsStateCompatible(*local, state))
+	{
+		_statistics.NumElidedBarriers += 1;
+		return;
+	}
+
+	QueueBarrier(
+	{
+		.Resource = resource,
+		.StateBefore = *local,
+		.StateAfter = state,
+		.SubresourceIndex = subresource
+	});
+
+	local = state;
+	tracked.bTransitioned = true;
+}
+
+ID3D12CommandList* RHIDeviceContext::RecordResolveBarriers(span<const RHITransitionBarrier> barriers)
+{
+	if (barriers.empty())
+	{
+		return nullptr;
+	}
+
+	GetDevice()->AccumulateStatistics({ .NumCommands = 1, .NumBarriers = (uint64)barriers.size() });
+	if (_bNullDevice)
+	{
+		return nullptr;
+	}
+
+	// Resolve barriers are recorded to separated command list that executed before command list of this context.
+	ID3D12Device* d3ddev = GetDevice()->GetDevice();
+	if (!_resolveAllocator)
+	{
+		HR(LogRHI, d3ddev->CreateCommandAllocator((D3D12_COMMAND_LIST_TYPE)_type, IID_PPV_ARGS(&_resolveAllocator)));
+	}
+
+	if (_resolveCommandList)
+	{
+		HR_E(LogRHI, _resolveCommandList->Reset(_resolveAllocator.Get(), nullptr));
+	}
+	else
+	{
+		HR(LogRHI, d3ddev->CreateCommandList(0, (D3D12_COMMAND_LIST_TYPE)_type, _resolveAllocator.Get(), nullptr, IID_PPV_ARGS(&_resolveCommandList)));
+	}
+
+	RecordBarriers(_resolveCommandList.Get(), barriers);
+	HR_E(LogRHI, _resolveCommandList->Close());
+	return _resolveCommandList.Get();
+}
+
+void RHIDeviceContext::QueueBarrier(const RHITransitionBarrier& barrier)
+{
+	for (auto it = _pendingBarriers.begin(); it != _pendingBarriers.end(); ++it)
+	{
+		if (it->Resource != barrier.Resource)
+		{
+			continue;
+		}
+
+		if (it->SubresourceIndex == barrier.SubresourceIndex)
+		{
+			// No work uses resource between queued transitions, so they are merged into one.
+			// If the merged transition returns to original state, both are cancelled.
+			it->StateAfter = barrier.StateAfter;
+			if (it->StateBefore == it->StateAfter)
+			{
+				_pendingBarriers.erase(it);
+				_statistics.NumElidedBarriers += 2;
+			}
+			else
+			{
+				_statistics.NumElidedBarriers += 1;
+			}
+			return;
+		}
+
+		if (it->SubresourceIndex == RHIResource::AllSubresources || barrier.SubresourceIndex == RHIResource::AllSubresources)
+		{
+			// Transition of all subresources overlaps transition of single subresource. Keep order by flushing queued transitions.
+			FlushBarriers();
+			break;
+		}
+	}
+
+	_pendingBarriers.emplace_back(barrier);
 }
\ No newline at end of file
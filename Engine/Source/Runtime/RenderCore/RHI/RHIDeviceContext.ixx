@@ -2,10 +2,14 @@
 
 export module SC.Runtime.RenderCore:RHIDeviceContext;
 
+import std.core;
 import :RHIDeviceChild;
 import :RHIEnums;
 import :ComPtr;
 import :RHIStructures;
+import :RHIResource;
+
+using namespace std;
 
 export class RHIDevice;
 export class RHIShader;
@@ -13,16 +17,56 @@ export class RHIRenderTargetView;
 
 /// <summary>
 /// Represents a device context which generates rendering commands.
+/// Pipeline states that bound to command list are shadowed, and commands that set same state again are elided.
+/// Resource state transitions are queued, and flushed as single barrier command before next draw, clear or copy.
+/// Resource states are tracked locally, so device contexts can be recorded in parallel. First transition of each resource
+/// is resolved against state of resource by queue at submission, in order of submission.
 /// </summary>
 export class RHIDeviceContext : public RHIDeviceChild
 {
 public:
 	using Super = RHIDeviceChild;
 
+	/// <summary>
+	/// The count of vertex buffer slots that shadowed.
+	/// </summary>
+	static constexpr uint32 MaxVertexBufferSlots = 32;
+
 private:
+	struct ShadowState
+	{
+		RHIShader* Shader = nullptr;
+		ID3D12RootSignature* RootSignature = nullptr;
+		ID3D12PipelineState* PipelineState = nullptr;
+		optional<ERHIPrimitiveTopology> Topology;
+		optional<vector<RHIViewport>> Viewports;
+		optional<vector<RHIScissorRect>> ScissorRects;
+		RHIRenderTargetView* RenderTargetView = nullptr;
+		int32 RenderTargetIndex = 0;
+		int32 RenderTargetCount = 0;
+		array<RHIVertexBufferView, MaxVertexBufferSlots> VertexBuffers;
+		uint32 VertexBufferMask = 0;
+	};
+
+	struct TrackedResource
+	{
+		// State of all subresources if SubresourceStates is empty. nullopt until this context uses resource.
+		optional<ERHIResourceStates> State;
+		vector<optional<ERHIResourceStates>> SubresourceStates;
+		uint8 bTransitioned : 1 = false;
+	};
+
 	const ERHICommandType _type;
+	const uint8 _bNullDevice : 1;
 	ComPtr<ID3D12CommandAllocator> _allocator;
 	ComPtr<ID3D12GraphicsCommandList> _commandList;
+	ComPtr<ID3D12CommandAllocator> _resolveAllocator;
+	ComPtr<ID3D12GraphicsCommandList> _resolveCommandList;
+	RHIDeviceStatistics _statistics;
+	ShadowState _shadow;
+	vector<RHITransitionBarrier> _pendingBarriers;
+	unordered_map<RHIResource*, TrackedResource> _trackedResources;
+	vector<RHITransitionBarrier> _initialTransitions;
 
 public:
 	/// <summary>
@@ -94,21 +138,62 @@ public:
 	virtual void RSSetViewports(int32 count, const RHIViewport* viewports);
 
 	/// <summary>
-	/// Set transition barriers.
+	/// Set transition barriers immediately. Queued transitions are flushed before, and tracked states of resources are updated.
+	/// If this context does not use resource before, resource is transitioned to state before of barrier at submission.
 	/// </summary>
 	virtual void TransitionBarrier(int32 count, const RHITransitionBarrier* barriers);
 
+	/// <summary>
+	/// Queue transition of resource from tracked state to desired state. Transition is elided if resource is already in the state,
+	/// and merged or cancelled with queued transition of same subresource. First transition of resource in this context is resolved at submission.
+	/// </summary>
+	/// <param name="resource"> The resource. </param>
+	/// <param name="state"> The desired state. </param>
+	/// <param name="subresource"> The subresource index. </param>
+	virtual void TransitionState(RHIResource* resource, ERHIResourceStates state, uint32 subresource = RHIResource::AllSubresources);
+
+	/// <summary>
+	/// Record queued transitions as single barrier command.
+	/// </summary>
+	void FlushBarriers();
+
+	/// <summary>
+	/// Copy entire resource. Resources are transitioned to copy states automatically.
+	/// </summary>
+	virtual void CopyResource(RHIResource* dstResource, RHIResource* srcResource);
+
 	/// <summary>
 	/// Set vertex buffer view to IA slot.
 	/// </summary>
 	virtual void IASetVertexBuffers(uint32 startSlot, uint32 numViews, const RHIVertexBufferView* views);
 
+	/// <summary>
+	/// Get counts of commands that recorded or elided since last Begin().
+	/// </summary>
+	const RHIDeviceStatistics& GetStatistics() const { return _statistics; }
+
+	/// <summary>
+	/// Forget shadowed states, so next commands are recorded regardless of previous state.
+	/// Call this after command list state is changed without this device context.
+	/// </summary>
+	void InvalidateStates();
+
 public /*internal*/:
 	ID3D12CommandList* GetCommandList() const { return _commandList.Get(); }
+	ID3D12CommandList* ResolveResourceStates();
 
 protected:
 	/// <summary>
 	/// Swap the allocator.
 	/// </summary>
 	void SwapAllocator(ComPtr<ID3D12CommandAllocator>&& swap);
+
+private:
+	bool RecordCommand(uint64 numDrawCalls = 0, uint64 numBarriers = 0);
+	void ElideCommand();
+	void QueueBarrier(const RHITransitionBarrier& barrier);
+	span<optional<ERHIResourceStates>> GetLocalStates(RHIResource* resource, TrackedResource& tracked, uint32 subresource, uint32& firstSubresource);
+	void CollapseLocalStates(TrackedResource& tracked);
+	void TransitionSubresource(RHIResource* resource, TrackedResource& tracked, optional<ERHIResourceStates>& local, ERHIResourceStates state, uint32 subresource);
+	ID3D12CommandList* RecordResolveBarriers(span<const RHITransitionBarrier> barriers);
 };
\ No newline at end of file
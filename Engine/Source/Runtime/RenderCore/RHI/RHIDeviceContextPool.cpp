@@ -0,0 +1,66 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+
+RHIDeviceContextPool::RHIDeviceContextPool(RHIDevice* device, int32 numFrames, ERHICommandType commandType) : Super(device)
+	, _type(commandType)
+	, _frameContexts(max(numFrames, 1))
+{
+}
+
+RHIDeviceContextPool::~RHIDeviceContextPool()
+{
+}
+
+span<RHIDeviceContext*> RHIDeviceContextPool::Acquire(int32 frameIndex, size_t count)
+{
+	vector<RHIDeviceContext*>& contexts = _frameContexts[frameIndex];
+
+	// Subobjects are created on calling thread only.
+	while (contexts.size() < count)
+	{
+		contexts.emplace_back(CreateSubobject<RHIDeviceContext>(GetDevice(), _type));
+	}
+
+	return span(contexts).subspan(0, count);
+}
+
+span<RHIDeviceContext*> RHIDeviceContextPool::RecordParallel(int32 frameIndex, size_t count, const RecordFunction& body, size_t minBatchSize)
+{
+	if (count == 0)
+	{
+		return {};
+	}
+
+	// One range for each thread that can record, include calling thread.
+	size_t numBatches = (count + max(minBatchSize, (size_t)1) - 1) / max(minBatchSize, (size_t)1);
+	numBatches = min(numBatches, JobSystem::GetNumWorkers() + 1);
+
+	span<RHIDeviceContext*> contexts = Acquire(frameIndex, numBatches);
+	auto recordBatch = [&](size_t batchIndex)
+	{
+		size_t begin = count * batchIndex / numBatches;
+		size_t end = count * (batchIndex + 1) / numBatches;
+
+		RHIDeviceContext* deviceContext = contexts[batchIndex];
+		deviceContext->Begin();
+		body(deviceContext, begin, end);
+		deviceContext->End();
+	};
+
+	JobCounter counter;
+	for (size_t i = 1; i < numBatches; ++i)
+	{
+		JobSystem::Schedule([&recordBatch, i]() { recordBatch(i); }, &counter);
+	}
+
+	// Calling thread records first range, and helps workers while waiting.
+	recordBatch(0);
+	counter.Wait();
+
+	return contexts;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIDeviceContextPool;
+
+import std.core;
+import SC.Runtime.Core;
+import :RHIDeviceChild;
+import :RHIEnums;
+
+using namespace std;
+
+export class RHIDevice;
+export class RHIDeviceContext;
+
+/// <summary>
+/// Represents pool of device contexts for each frame in flight. Each device context owns its command allocator,
+/// so worker threads can record commands concurrently into separate device contexts.
+/// Device contexts of frame slot can be reused after GPU completes the frame that used the slot before.
+/// </summary>
+export class RHIDeviceContextPool : public RHIDeviceChild
+{
+public:
+	using Super = RHIDeviceChild;
+
+	/// <summary>
+	/// Represents function that record range of items to device context.
+	/// </summary>
+	using RecordFunction = function<void(RHIDeviceContext* deviceContext, size_t begin, size_t end)>;
+
+private:
+	const ERHICommandType _type;
+	vector<vector<RHIDeviceContext*>> _frameContexts;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIDeviceContextPool"/> instance.
+	/// </summary>
+	/// <param name="device"> The logical device. </param>
+	/// <param name="numFrames"> The count of frame slots. </param>
+	/// <param name="commandType"> Specify command type for usage. </param>
+	RHIDeviceContextPool(RHIDevice* device, int32 numFrames, ERHICommandType commandType = ERHICommandType::Direct);
+	~RHIDeviceContextPool() override;
+
+	/// <summary>
+	/// Get device contexts of frame slot. Device contexts are created if pool have not enough contexts.
+	/// </summary>
+	/// <param name="frameIndex"> The frame slot index. </param>
+	/// <param name="count"> The count of device contexts. </param>
+	span<RHIDeviceContext*> Acquire(int32 frameIndex, size_t count);
+
+	/// <summary>
+	/// Record items with multiple device contexts in parallel. Items are split to contiguous ranges,
+	/// and each range is recorded to own device context on job system.
+	/// Returned device contexts are ordered by ranges, so submitting them in order is deterministic.
+	/// </summary>
+	/// <param name="frameIndex"> The frame slot index. </param>
+	/// <param name="count"> The count of items. </param>
+	/// <param name="body"> The function that record items. Begin() and End() are called by pool. </param>
+	/// <param name="minBatchSize"> The minimum count of items that recorded by single device context. </param>
+	/// <returns> The recorded device contexts. </returns>
+	span<RHIDeviceContext*> RecordParallel(int32 frameIndex, size_t count, const RecordFunction& body, size_t minBatchSize = 256);
+
+	/// <summary>
+	/// Get count of frame slots.
+	/// </summary>
+	int32 GetNumFrames() const { return (int32)_frameContexts.size(); }
+};
\ No newline at end of file
@@ -85,6 +85,18 @@ export enum class ERHIResourceStates
 };
 DEFINE_ENUM_FLAG_OPERATORS(ERHIResourceStates);
 
+/// <summary>
+/// Specifies the usages of resource that must be allowed at creation.
+/// </summary>
+export enum class ERHIResourceFlags
+{
+	None = 0,
+	AllowRenderTarget = 0x1,
+	AllowDepthStencil = 0x2,
+	AllowUnorderedAccess = 0x4,
+};
+DEFINE_ENUM_FLAG_OPERATORS(ERHIResourceFlags);
+
 
 /// <summary>
 /// Declare pixel formats.
@@ -277,4 +289,46 @@ export enum class ERHIShaderParameterType
     ParameterCollection_CameraConstants,
 
     ParameterCollection
+};
+
+/// <summary>
+/// Specifies backend of logical device.
+/// </summary>
+export enum class ERHIDeviceType
+{
+	/// <summary>
+	/// The Direct3D 12 device.
+	/// </summary>
+	D3D12,
+
+	/// <summary>
+	/// The null device that does not use GPU. Commands are counted and discarded, and fences are completed on signal.
+	/// </summary>
+	Null,
+};
+
+/// <summary>
+/// Specifies the type of descriptor heap.
+/// </summary>
+export enum class ERHIDescriptorHeapType
+{
+	/// <summary>
+	/// The descriptor heap for the combination of constant buffer, shader resource and unordered access views.
+	/// </summary>
+	CBV_SRV_UAV = 0,
+
+	/// <summary>
+	/// The descriptor heap for the sampler.
+	/// </summary>
+	Sampler = 1,
+
+	/// <summary>
+	/// The descriptor heap for the render target view.
+	/// </summary>
+	RTV = 2,
+
+	/// <summary>
+	/// The descriptor heap for the depth stencil view.
+	/// </summary>
+	DSV = 3,
 };
\ No newline at end of file
@@ -0,0 +1,289 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+#include "Internal.h"
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+using namespace std::chrono;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	constexpr uint32 CacheFileMagic = 0x43535050;	// 'PPSC'
+	constexpr uint32 CacheFileVersion = 1;
+
+	constexpr uint64 FNV_Prime = 1099511628211ULL;
+	constexpr uint64 FNV_Basis = 14695981039346656037ULL;
+
+	uint64 HashBytes(uint64 hash, const void* data, size_t size)
+	{
+		auto* bytes = (const uint8*)data;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * FNV_Prime;
+		}
+		return hash;
+	}
+
+	template<class T>
+	uint64 HashValue(uint64 hash, const T& value)
+	{
+		return HashBytes(hash, &value, sizeof(T));
+	}
+}
+
+RHIPipelineStateCache::RHIPipelineStateCache(RHIDevice* device) : Super(device)
+{
+}
+
+RHIPipelineStateCache::~RHIPipelineStateCache()
+{
+}
+
+bool RHIPipelineStateCache::Load(const filesystem::path& filepath)
+{
+	ifstream stream(filepath, ios::binary);
+	if (!stream.is_open())
+	{
+		LogSystem::Log<Info>(LogRHI, L"Pipeline state cache file is not exists. Pipeline states will be created from scratch.");
+		return false;
+	}
+
+	stream.seekg(0, ios::end);
+	const uint64 fileSize = (uint64)stream.tellg();
+	stream.seekg(0, ios::beg);
+
+	// Sizes are read from file, so they are bounded by remaining bytes before allocating.
+	auto getRemaining = [&stream, fileSize]() -> uint64
+	{
+		return fileSize - (uint64)stream.tellg();
+	};
+
+	auto readBlob = [&stream, &getRemaining](vector<uint8>& blob)
+	{
+		uint64 size = 0;
+		if (!stream.read((char*)&size, sizeof(size)) || size > getRemaining())
+		{
+			return false;
+		}
+
+		blob.resize((size_t)size);
+		return (bool)stream.read((char*)blob.data(), (streamsize)size);
+	};
+
+	uint32 magic = 0, version = 0;
+	uint64 count = 0;
+	stream.read((char*)&magic, sizeof(magic));
+	stream.read((char*)&version, sizeof(version));
+	stream.read((char*)&count, sizeof(count));
+	if (!stream || magic != CacheFileMagic || version != CacheFileVersion)
+	{
+		LogSystem::Log<Warning>(LogRHI, L"Pipeline state cache file is corrupted or outdated. Ignored.");
+		return false;
+	}
+
+	// Each entry has key and sizes of two blobs at least.
+	constexpr uint64 MinEntrySize = sizeof(uint64) * 3;
+	if (count > getRemaining() / MinEntrySize)
+	{
+		LogSystem::Log<Warning>(LogRHI, L"Pipeline state cache file is corrupted. Ignored.");
+		return false;
+	}
+
+	unordered_map<uint64, Blobs> blobs;
+	bool bTruncated = false;
+	for (uint64 i = 0; i < count; ++i)
+	{
+		uint64 key = 0;
+		if (!stream.read((char*)&key, sizeof(key)))
+		{
+			bTruncated = true;
+			break;
+		}
+
+		Blobs& entry = blobs[key];
+		if (!readBlob(entry.RootSignature) || !readBlob(entry.PipelineState))
+		{
+			bTruncated = true;
+			break;
+		}
+	}
+
+	if (bTruncated)
+	{
+		LogSystem::Log<Warning>(LogRHI, L"Pipeline state cache file is truncated. Ignored.");
+		return false;
+	}
+
+	unique_lock lock(_lock);
+	_blobs = move(blobs);
+	_bDirty = false;
+	LogSystem::Log<Info>(LogRHI, L"Load {} pipeline states from cache file.", _blobs.size());
+	return true;
+}
+
+bool RHIPipelineStateCache::Save(const filesystem::path& filepath)
+{
+	unique_lock lock(_lock);
+	if (!_bDirty)
+	{
+		return true;
+	}
+
+	ofstream stream(filepath, ios::binary | ios::trunc);
+	if (!stream.is_open())
+	{
+		LogSystem::Log<Error>(LogRHI, L"Could not open pipeline state cache file to write.");
+		return false;
+	}
+
+	auto writeBlob = [&stream](const vector<uint8>& blob)
+	{
+		uint64 size = blob.size();
+		stream.write((const char*)&size, sizeof(size));
+		stream.write((const char*)blob.data(), (streamsize)size);
+	};
+
+	uint64 count = _blobs.size();
+	stream.write((const char*)&CacheFileMagic, sizeof(CacheFileMagic));
+	stream.write((const char*)&CacheFileVersion, sizeof(CacheFileVersion));
+	stream.write((const char*)&count, sizeof(count));
+
+	for (auto& [key, entry] : _blobs)
+	{
+		stream.write((const char*)&key, sizeof(key));
+		writeBlob(entry.RootSignature);
+		writeBlob(entry.PipelineState);
+	}
+
+	_bDirty = false;
+	LogSystem::Log<Info>(LogRHI, L"Save {} pipeline states to cache file.", count);
+	return (bool)stream;
+}
+
+RHIPipelineStateCacheStatistics RHIPipelineStateCache::GetStatistics()
+{
+	unique_lock lock(_lock);
+	return _statistics;
+}
+
+uint64 RHIPipelineStateCache::ComputeKey(span<uint8 const> vsBytecode, span<uint8 const> psBytecode, span<RHIShaderParameterElement const> shaderParameters, span<RHIVertexElement const> vertexDeclaration)
+{
+	uint64 hash = FNV_Basis;
+	hash = HashValue(hash, vsBytecode.size());
+	hash = HashBytes(hash, vsBytecode.data(), vsBytecode.size());
+	hash = HashValue(hash, psBytecode.size());
+	hash = HashBytes(hash, psBytecode.data(), psBytecode.size());
+
+	hash = HashValue(hash, shaderParameters.size());
+	for (auto& parameter : shaderParameters)
+	{
+		hash = HashValue(hash, parameter.Type);
+		hash = HashValue(hash, parameter.ParameterCollection.ShaderRegister);
+		hash = HashValue(hash, parameter.ParameterCollection.RegisterSpace);
+	}
+
+	hash = HashValue(hash, vertexDeclaration.size());
+	for (auto& element : vertexDeclaration)
+	{
+		hash = HashBytes(hash, element.SemanticName.c_str(), element.SemanticName.length() + 1);
+		hash = HashValue(hash, element.SemanticIndex);
+		hash = HashValue(hash, element.AlignedByteOffset);
+		hash = HashValue(hash, element.Format);
+		hash = HashValue(hash, element.InputSlot);
+		hash = HashValue(hash, element.InputSlotClass);
+	}
+
+	return hash;
+}
+
+void RHIPipelineStateCache::FindOrCreate(uint64 key, const D3D12_ROOT_SIGNATURE_DESC& rsd, D3D12_GRAPHICS_PIPELINE_STATE_DESC& psd, ComPtr<ID3D12RootSignature>& outRootSignature, ComPtr<ID3D12PipelineState>& outPipelineState)
+{
+	unique_lock lock(_lock);
+
+	if (auto it = _pipelines.find(key); it != _pipelines.end())
+	{
+		++_statistics.NumMemoryHits;
+		outRootSignature = it->second.RootSignature;
+		outPipelineState = it->second.PipelineState;
+		return;
+	}
+
+	steady_clock::time_point begin = steady_clock::now();
+	ID3D12Device* dev = GetDevice()->GetDevice();
+	Pipeline pipeline;
+	Blobs& blobs = _blobs[key];
+
+	// Serialized root signature is stored, so serializing can be skipped.
+	if (blobs.RootSignature.empty())
+	{
+		ComPtr<ID3DBlob> blob, error;
+		HRESULT hr = D3D12SerializeRootSignature(&rsd, D3D_ROOT_SIGNATURE_VERSION_1_0, &blob, &error);
+		if (FAILED(hr))
+		{
+			// Compile error detected. Print error message and throw fatal exception.
+			if (error)
+			{
+				LogSystem::Log<Fatal>(LogRHI,
+					L"Could not compile root signature with follow reason:\n{}",
+					StringUtils::AsUnicode((const char*)error->GetBufferPointer()));
+			}
+			else
+			{
+				HR(LogRHI, hr);
+			}
+		}
+
+		auto* bytes = (const uint8*)blob->GetBufferPointer();
+		blobs.RootSignature.assign(bytes, bytes + blob->GetBufferSize());
+		_bDirty = true;
+	}
+
+	HR(LogRHI, dev->CreateRootSignature(0, blobs.RootSignature.data(), blobs.RootSignature.size(), IID_PPV_ARGS(&pipeline.RootSignature)));
+	psd.pRootSignature = pipeline.RootSignature.Get();
+
+	bool bCreated = false;
+	if (!blobs.PipelineState.empty())
+	{
+		// Cached blob is rejected if driver or adapter is changed. Create from scratch in that case.
+		psd.CachedPSO = { .pCachedBlob = blobs.PipelineState.data(), .CachedBlobSizeInBytes = blobs.PipelineState.size() };
+		bCreated = SUCCEEDED(dev->CreateGraphicsPipelineState(&psd, IID_PPV_ARGS(&pipeline.PipelineState)));
+		psd.CachedPSO = {};
+
+		if (!bCreated)
+		{
+			LogSystem::Log<Verbose>(LogRHI, L"Cached pipeline state is rejected by driver. Create from scratch.");
+		}
+	}
+
+	if (bCreated)
+	{
+		++_statistics.NumDiskHits;
+	}
+	else
+	{
+		HR(LogRHI, dev->CreateGraphicsPipelineState(&psd, IID_PPV_ARGS(&pipeline.PipelineState)));
+
+		ComPtr<ID3DBlob> cached;
+		if (SUCCEEDED(pipeline.PipelineState->GetCachedBlob(&cached)))
+		{
+			auto* bytes = (const uint8*)cached->GetBufferPointer();
+			blobs.PipelineState.assign(bytes, bytes + cached->GetBufferSize());
+			_bDirty = true;
+		}
+
+		++_statistics.NumMisses;
+	}
+
+	_statistics.CreationTime += steady_clock::now() - begin;
+
+	outRootSignature = pipeline.RootSignature;
+	outPipelineState = pipeline.PipelineState;
+	_pipelines.emplace(key, move(pipeline));
+}
\ No newline at end of file
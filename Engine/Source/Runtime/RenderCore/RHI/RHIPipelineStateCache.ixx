@@ -0,0 +1,107 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIPipelineStateCache;
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore.Internal;
+import :ComPtr;
+import :RHIDeviceChild;
+import :RHIStructures;
+
+using namespace std;
+using namespace std::chrono;
+
+export class RHIDevice;
+
+/// <summary>
+/// Represents counts of pipeline state requests that resolved by cache.
+/// </summary>
+export struct RHIPipelineStateCacheStatistics
+{
+	/// <summary>
+	/// Count of requests that found pipeline state in memory.
+	/// </summary>
+	uint64 NumMemoryHits = 0;
+
+	/// <summary>
+	/// Count of requests that created pipeline state from blob in disk cache.
+	/// </summary>
+	uint64 NumDiskHits = 0;
+
+	/// <summary>
+	/// Count of requests that created pipeline state from scratch.
+	/// </summary>
+	uint64 NumMisses = 0;
+
+	/// <summary>
+	/// Total time elapsed to create root signatures and pipeline states.
+	/// </summary>
+	duration<float> CreationTime = 0ns;
+};
+
+/// <summary>
+/// Represents cache of root signatures and pipeline states, keyed by hash of shader bytecode, shader parameter declaration and vertex declaration.
+/// Identical requests share same objects, and serialized blobs are persisted to disk cache file that later runs load.
+/// </summary>
+export class RHIPipelineStateCache : public RHIDeviceChild
+{
+public:
+	using Super = RHIDeviceChild;
+
+private:
+	struct Pipeline
+	{
+		ComPtr<ID3D12RootSignature> RootSignature;
+		ComPtr<ID3D12PipelineState> PipelineState;
+	};
+
+	struct Blobs
+	{
+		vector<uint8> RootSignature;
+		vector<uint8> PipelineState;
+	};
+
+	mutex _lock;
+	unordered_map<uint64, Pipeline> _pipelines;
+	unordered_map<uint64, Blobs> _blobs;
+	bool _bDirty = false;
+	RHIPipelineStateCacheStatistics _statistics;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIPipelineStateCache"/> instance.
+	/// </summary>
+	/// <param name="device"> The logical device. </param>
+	RHIPipelineStateCache(RHIDevice* device);
+	~RHIPipelineStateCache() override;
+
+	/// <summary>
+	/// Load serialized blobs from disk cache file. Blobs that created by different driver are recreated on request.
+	/// </summary>
+	/// <param name="filepath"> The cache file path. </param>
+	/// <returns> Return false if file is not exists or corrupted. </returns>
+	bool Load(const filesystem::path& filepath);
+
+	/// <summary>
+	/// Save serialized blobs to disk cache file, if any pipeline state is created after load.
+	/// </summary>
+	/// <param name="filepath"> The cache file path. </param>
+	/// <returns> Return false if file could not be written. </returns>
+	bool Save(const filesystem::path& filepath);
+
+	/// <summary>
+	/// Get counts of requests.
+	/// </summary>
+	RHIPipelineStateCacheStatistics GetStatistics();
+
+	/// <summary>
+	/// Compute cache key of pipeline.
+	/// </summary>
+	static uint64 ComputeKey(span<uint8 const> vsBytecode, span<uint8 const> psBytecode, span<RHIShaderParameterElement const> shaderParameters, span<RHIVertexElement const> vertexDeclaration);
+
+public /*internal*/:
+	void FindOrCreate(uint64 key, const D3D12_ROOT_SIGNATURE_DESC& rsd, D3D12_GRAPHICS_PIPELINE_STATE_DESC& psd, ComPtr<ID3D12RootSignature>& outRootSignature, ComPtr<ID3D12PipelineState>& outPipelineState);
+};
\ No newline at end of file
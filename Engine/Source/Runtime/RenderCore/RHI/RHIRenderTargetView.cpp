@@ -4,35 +4,36 @@
 
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
+import std.core;
 
 RHIRenderTargetView::RHIRenderTargetView(RHIDevice* device, uint32 descriptorCount) : Super(device)
 	, _descriptorCount(descriptorCount)
+	, _textures(descriptorCount)
 {
-	ID3D12Device* dev = device->GetDevice();
-	D3D12_DESCRIPTOR_HEAP_DESC heapd =
-	{
-		.Type = D3D12_DESCRIPTOR_HEAP_TYPE_RTV,
-		.NumDescriptors = descriptorCount,
-		.Flags = D3D12_DESCRIPTOR_HEAP_FLAG_NONE,
-	};
-	HR(LogRHI, dev->CreateDescriptorHeap(&heapd, IID_PPV_ARGS(&_descriptor)));
-	_increment = dev->GetDescriptorHandleIncrementSize(heapd.Type);
+	_allocation = device->GetDescriptorAllocator()->Allocate(ERHIDescriptorHeapType::RTV, descriptorCount);
+}
+
+RHIRenderTargetView::~RHIRenderTargetView()
+{
+	GetDevice()->GetDescriptorAllocator()->Free(_allocation);
 }
 
 void RHIRenderTargetView::CreateRenderTargetView(RHITexture2D* texture, int32 index)
 {
-	ID3D12Resource* resource = texture->GetResource();
-	ID3D12Device* dev = GetDevice()->GetDevice();
+	_textures[index] = texture;
 
-	D3D12_CPU_DESCRIPTOR_HANDLE handle = _descriptor->GetCPUDescriptorHandleForHeapStart();
-	handle.ptr += _increment * index;
+	// Null device have not descriptor heap. Handles are reserved only.
+	ID3D12Device* dev = GetDevice()->GetDevice();
+	if (dev == nullptr || !_allocation.IsValid())
+	{
+		return;
+	}
 
-	dev->CreateRenderTargetView(resource, nullptr, handle);
+	ID3D12Resource* resource = texture->GetResource();
+	dev->CreateRenderTargetView(resource, nullptr, GetCPUDescriptorHandle(index));
 }
 
 D3D12_CPU_DESCRIPTOR_HANDLE RHIRenderTargetView::GetCPUDescriptorHandle(int32 index) const
 {
-	D3D12_CPU_DESCRIPTOR_HANDLE handle = _descriptor->GetCPUDescriptorHandleForHeapStart();
-	handle.ptr += _increment * index;
-	return handle;
+	return { .ptr = (SIZE_T)_allocation.GetCPUHandle((uint32)index) };
 }
\ No newline at end of file
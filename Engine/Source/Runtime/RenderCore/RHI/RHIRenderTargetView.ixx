@@ -2,14 +2,17 @@
 
 export module SC.Runtime.RenderCore:RHIRenderTargetView;
 
+import std.core;
 import :RHIView;
+import :RHIDescriptorAllocator;
 import SC.Runtime.RenderCore.Internal;
-import :ComPtr;
+
+using namespace std;
 
 export class RHITexture2D;
 
 /// <summary>
-/// Represents render target view for binding to gpu output.
+/// Represents render target view for binding to gpu output. Descriptors are allocated from descriptor allocator of device.
 /// </summary>
 export class RHIRenderTargetView : public RHIView
 {
@@ -17,12 +20,13 @@ public:
 	using Super = RHIView;
 
 private:
-	ComPtr<ID3D12DescriptorHeap> _descriptor;
 	const uint32 _descriptorCount = 0;
-	uint32 _increment = 0;
+	RHIDescriptorAllocation _allocation;
+	vector<RHITexture2D*> _textures;
 
 public:
 	RHIRenderTargetView(RHIDevice* device, uint32 descriptorCount);
+	~RHIRenderTargetView() override;
 
 	/// <summary>
 	/// Create render target view.
@@ -34,6 +38,11 @@ public:
 	/// </summary>
 	int32 GetDescriptorCount() const { return _descriptorCount; }
 
+	/// <summary>
+	/// Get texture that view is created for. Device contexts transition the texture to render target state when view is bound or cleared.
+	/// </summary>
+	RHITexture2D* GetTexture(int32 index) const { return _textures[index]; }
+
 public /*internal*/:
 	D3D12_CPU_DESCRIPTOR_HANDLE GetCPUDescriptorHandle(int32 index = 0) const;
 };
\ No newline at end of file
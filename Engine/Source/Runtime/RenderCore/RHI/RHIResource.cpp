@@ -4,10 +4,29 @@
 
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
+import std.core;
 
-RHIResource::RHIResource(RHIDevice* device, ID3D12Resource* resource) : Super(device)
+using namespace std;
+
+RHIResource::RHIResource(RHIDevice* device, ID3D12Resource* resource, uint64 nullSize, ERHIResourceStates initialState) : Super(device)
 	, _resource(resource)
+	, _state(initialState)
 {
+	if (device->IsNullDevice())
+	{
+		_nullAddress = device->AllocateNullAddress(nullSize);
+	}
+
+	if (_resource.IsSet())
+	{
+		// Planes of depth stencil formats are not tracked separately.
+		D3D12_RESOURCE_DESC desc = _resource->GetDesc();
+		if (desc.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER)
+		{
+			uint32 arraySize = desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D ? 1 : desc.DepthOrArraySize;
+			_numSubresources = max((uint32)desc.MipLevels, 1u) * arraySize;
+		}
+	}
 }
 
 RHIResource::~RHIResource()
@@ -16,5 +35,48 @@ RHIResource::~RHIResource()
 
 uint64 RHIResource::GetGPUVirtualAddress() const
 {
+	if (!_resource.IsSet())
+	{
+		return _nullAddress;
+	}
+
 	return _resource->GetGPUVirtualAddress();
+}
+
+optional<ERHIResourceStates> RHIResource::GetState(uint32 subresource) const
+{
+	if (_subresourceStates.empty())
+	{
+		return _state;
+	}
+
+	if (subresource == AllSubresources)
+	{
+		return nullopt;
+	}
+
+	return _subresourceStates[subresource];
+}
+
+void RHIResource::SetState(uint32 subresource, ERHIResourceStates state)
+{
+	if (subresource == AllSubresources || _numSubresources == 1)
+	{
+		_state = state;
+		_subresourceStates.clear();
+		return;
+	}
+
+	// Expand uniform state to per subresource states, and collapse it again if all states are same.
+	if (_subresourceStates.empty())
+	{
+		_subresourceStates.resize(_numSubresources, _state);
+	}
+
+	_subresourceStates[subresource] = state;
+	if (all_of(_subresourceStates.begin(), _subresourceStates.end(), [state](ERHIResourceStates s) { return s == state; }))
+	{
+		_state = state;
+		_subresourceStates.clear();
+	}
 }
\ No newline at end of file
@@ -2,10 +2,14 @@
 
 export module SC.Runtime.RenderCore:RHIResource;
 
+import std.core;
 import SC.Runtime.Core;
 import :RHIDeviceChild;
+import :RHIEnums;
 import :ComPtr;
 
+using namespace std;
+
 /// <summary>
 /// Represents render resources.
 /// </summary>
@@ -14,11 +18,27 @@ export class RHIResource : public RHIDeviceChild
 public:
 	using Super = RHIDeviceChild;
 
+	/// <summary>
+	/// The subresource index that indicates all subresources.
+	/// </summary>
+	static constexpr uint32 AllSubresources = 0xFFFFFFFF;
+
 private:
 	ComPtr<ID3D12Resource> _resource;
+	uint64 _nullAddress = 0;
+	uint32 _numSubresources = 1;
+	ERHIResourceStates _state = ERHIResourceStates::Common;
+	vector<ERHIResourceStates> _subresourceStates;
 
 public:
-	RHIResource(RHIDevice* device, ID3D12Resource* resource);
+	/// <summary>
+	/// Initialize new <see cref="RHIResource"/> instance.
+	/// </summary>
+	/// <param name="device"> The logical device. </param>
+	/// <param name="resource"> The native resource. nullptr if device is null device. </param>
+	/// <param name="nullSize"> The size of resource that reserved as virtual address range on null device. </param>
+	/// <param name="initialState"> The state of all subresources that native resource is created with. </param>
+	RHIResource(RHIDevice* device, ID3D12Resource* resource, uint64 nullSize = 0, ERHIResourceStates initialState = ERHIResourceStates::Common);
 	~RHIResource() override;
 
 	/// <summary>
@@ -26,6 +46,25 @@ public:
 	/// </summary>
 	virtual uint64 GetGPUVirtualAddress() const;
 
+	/// <summary>
+	/// Get count of subresources.
+	/// </summary>
+	uint32 GetNumSubresources() const { return _numSubresources; }
+
+	/// <summary>
+	/// Indicate all subresources are in same state.
+	/// </summary>
+	bool IsUniformState() const { return _subresourceStates.empty(); }
+
+	/// <summary>
+	/// Get state of subresource after command lists that submitted to queue so far. Device contexts track states locally while recording,
+	/// and queue updates these states in order of submission. Read this on the thread that submits command lists using resource.
+	/// </summary>
+	/// <param name="subresource"> The subresource index. </param>
+	/// <returns> The state. nullopt if all subresources is specified and subresources are in different states. </returns>
+	optional<ERHIResourceStates> GetState(uint32 subresource = AllSubresources) const;
+
 public /*internal*/:
 	ID3D12Resource* GetResource() const { return _resource.Get(); }
+	void SetState(uint32 subresource, ERHIResourceStates state);
 };
\ No newline at end of file
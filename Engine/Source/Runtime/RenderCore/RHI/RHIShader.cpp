@@ -4,6 +4,7 @@
 
 import SC.Runtime.RenderCore;
 import std.core;
+import std.threading;
 import SC.Runtime.Core;
 
 using namespace std;
@@ -18,11 +19,39 @@ RHIShader::~RHIShader()
 {
 }
 
+void RHIShader::SetBytecodeFuture(shared_future<vector<uint8>> vsBytecode, shared_future<vector<uint8>> psBytecode)
+{
+	_vsFuture = move(vsBytecode);
+	_psFuture = move(psBytecode);
+}
+
 void RHIShader::Compile(RHIVertexFactory* vertexDeclaration)
 {
-	span<uint8 const> vsBytecode = CompileVS();
-	span<uint8 const> psBytecode = CompilePS();
-	ID3D12Device* dev = GetDevice()->GetDevice();
+	// Bytecode of future is kept by shared state until shader is destroyed, so span is valid.
+	auto resolveBytecode = [](const shared_future<vector<uint8>>& future, function<span<uint8 const>()> fallback) -> span<uint8 const>
+	{
+		if (future.valid())
+		{
+			const vector<uint8>& bytecode = future.get();
+			if (!bytecode.empty())
+			{
+				return bytecode;
+			}
+
+			LogSystem::Log<Warning>(LogRHI, L"Asynchronous shader bytecode is not available. Fallback to synchronous compile.");
+		}
+
+		return fallback();
+	};
+
+	span<uint8 const> vsBytecode = resolveBytecode(_vsFuture, [this]() { return CompileVS(); });
+	span<uint8 const> psBytecode = resolveBytecode(_psFuture, [this]() { return CompilePS(); });
+
+	// Null device have not pipeline state. Bytecode is compiled for validation only.
+	if (GetDevice()->IsNullDevice())
+	{
+		return;
+	}
 
 	vector<RHIShaderParameterElement> shaderParameters = GetShaderParameterDeclaration();
 	vector<D3D12_ROOT_PARAMETER> rootParameters;
@@ -45,7 +74,7 @@ void RHIShader::Compile(RHIVertexFactory* vertexDeclaration)
 			};
 			break;
 		default:
-			LogSystem::Log(LogRHI, Error, L"Shader parameter type({}) is corrupted.", (int32)myParam.Type);
+			LogSystem::Log<Error>(LogRHI, L"Shader parameter type({}) is corrupted.", (int32)myParam.Type);
 			rootParameters.emplace_back();
 			break;
 		}
@@ -65,25 +94,6 @@ void RHIShader::Compile(RHIVertexFactory* vertexDeclaration)
 		| D3D12_ROOT_SIGNATURE_FLAG_DENY_GEOMETRY_SHADER_ROOT_ACCESS
 	};
 
-	ComPtr<ID3DBlob> blob, error;
-	HRESULT hr = D3D12SerializeRootSignature(&rsd, D3D_ROOT_SIGNATURE_VERSION_1_0, &blob, &error);
-	if (FAILED(hr))
-	{
-		// Compile error detected. Print error message and throw fatal exception.
-		if (error)
-		{
-			LogSystem::Log(LogRHI, Fatal,
-				L"Could not compile root signature with follow reason:\n{}",
-				StringUtils::AsUnicode((const char*)error->GetBufferPointer()));
-		}
-		else
-		{
-			HR(LogRHI, hr);
-		}
-	}
-
-	HR(LogRHI, dev->CreateRootSignature(0, blob->GetBufferPointer(), blob->GetBufferSize(), IID_PPV_ARGS(&_rs)));
-
 	// Make vertex declaration to input element.
 	vector<RHIVertexElement> declaration = vertexDeclaration->GetVertexDeclaration();
 	vector<D3D12_INPUT_ELEMENT_DESC> inputElements(declaration.size());
@@ -106,7 +116,7 @@ void RHIShader::Compile(RHIVertexFactory* vertexDeclaration)
 
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC psd =
 	{
-		.pRootSignature = _rs.Get(),
+		.pRootSignature = nullptr,
 		.VS =
 		{
 			.pShaderBytecode = vsBytecode.data(),
@@ -160,5 +170,8 @@ void RHIShader::Compile(RHIVertexFactory* vertexDeclaration)
 		.SampleDesc = { 1, 0 },
 	};
 
-	HR(LogRHI, dev->CreateGraphicsPipelineState(&psd, IID_PPV_ARGS(&_ps)));
+	// Identical pipeline is shared, and serialized blobs are reused from disk cache.
+	RHIPipelineStateCache* cache = GetDevice()->GetPipelineStateCache();
+	uint64 key = RHIPipelineStateCache::ComputeKey(vsBytecode, psBytecode, shaderParameters, declaration);
+	cache->FindOrCreate(key, rsd, psd, _rs, _ps);
 }
\ No newline at end of file
@@ -6,6 +6,7 @@ import :RHIDeviceChild;
 import :ComPtr;
 import SC.Runtime.RenderCore.Internal;
 import std.core;
+import std.threading;
 import :RHIStructures;
 
 export class RHIDevice;
@@ -26,6 +27,8 @@ private:
 	RHIVertexFactory* _vfactory = nullptr;
 	ComPtr<ID3D12RootSignature> _rs;
 	ComPtr<ID3D12PipelineState> _ps;
+	shared_future<vector<uint8>> _vsFuture;
+	shared_future<vector<uint8>> _psFuture;
 
 public:
 	RHIShader(RHIDevice* device);
@@ -36,6 +39,14 @@ public:
 	/// </summary>
 	virtual void Compile(RHIVertexFactory* vertexDeclaration);
 
+	/// <summary>
+	/// Set bytecode that compiled asynchronously. <see cref="Compile"/> waits bytecode instead of calling CompileVS and CompilePS.
+	/// Empty bytecode that indicates compile failure is fallback to CompileVS and CompilePS.
+	/// </summary>
+	/// <param name="vsBytecode"> The future of vertex shader bytecode. </param>
+	/// <param name="psBytecode"> The future of pixel shader bytecode. </param>
+	void SetBytecodeFuture(shared_future<vector<uint8>> vsBytecode, shared_future<vector<uint8>> psBytecode);
+
 	/// <summary>
 	/// Provide shader parameter declaration of this shader program.
 	/// </summary>
@@ -0,0 +1,271 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+using namespace std::chrono;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	constexpr uint64 FNV_Prime = 1099511628211ULL;
+	constexpr uint64 FNV_Basis = 14695981039346656037ULL;
+
+	uint64 HashBytes(uint64 hash, const void* data, size_t size)
+	{
+		auto* bytes = (const uint8*)data;
+		for (size_t i = 0; i < size; ++i)
+		{
+			hash = (hash ^ bytes[i]) * FNV_Prime;
+		}
+		return hash;
+	}
+
+	uint64 HashString(uint64 hash, string_view value)
+	{
+		// Length is hashed together, so concatenated strings that have different boundary make different hash.
+		uint64 length = value.length();
+		hash = HashBytes(hash, &length, sizeof(length));
+		return HashBytes(hash, value.data(), value.length());
+	}
+}
+
+RHIShaderBytecodeCache::RHIShaderBytecodeCache(IRHIShaderCompiler* compiler, const filesystem::path& directory) : Super()
+	, _compiler(compiler)
+	, _compilerIdentity(compiler->GetIdentity())
+	, _directory(directory)
+{
+	if (!_directory.empty())
+	{
+		error_code ec;
+		filesystem::create_directories(_directory, ec);
+		if (ec)
+		{
+			LogSystem::Log<Warning>(LogRHI, L"Could not create shader cache directory. Compiled bytecode will not be persisted.");
+		}
+	}
+}
+
+RHIShaderBytecodeCache::~RHIShaderBytecodeCache()
+{
+	// Jobs refer this instance. Wait all jobs before destroy.
+	WaitAll();
+}
+
+auto RHIShaderBytecodeCache::Register(RHIShaderSource source) -> BytecodeFuture
+{
+	uint64 hash = ComputeHash(source, _compilerIdentity);
+
+	unique_lock lock(_lock);
+	if (auto it = _entries.find(hash); it != _entries.end())
+	{
+		++_statistics.NumMemoryHits;
+		return it->second.Future;
+	}
+
+	Entry& entry = _entries[hash];
+	entry.Source = move(source);
+	entry.Future = entry.Promise.get_future().share();
+	_pendings.emplace_back(hash);
+	return entry.Future;
+}
+
+void RHIShaderBytecodeCache::CompileAll()
+{
+	vector<pair<uint64, Entry*>> schedules;
+	{
+		unique_lock lock(_lock);
+		schedules.reserve(_pendings.size());
+		for (auto& hash : _pendings)
+		{
+			Entry& entry = _entries[hash];
+			entry.bScheduled = true;
+			schedules.emplace_back(hash, &entry);
+		}
+		_pendings.clear();
+	}
+
+	// Each shader is compiled on worker thread. Futures that returned from Register are satisfied when compile is completed.
+	for (auto& [hash, entry] : schedules)
+	{
+		JobSystem::Schedule([this, hash = hash, entry = entry]()
+		{
+			CompileEntry(hash, entry);
+		});
+	}
+}
+
+void RHIShaderBytecodeCache::WaitAll()
+{
+	vector<BytecodeFuture> futures;
+	{
+		unique_lock lock(_lock);
+		futures.reserve(_entries.size());
+		for (auto& [hash, entry] : _entries)
+		{
+			if (entry.bScheduled)
+			{
+				futures.emplace_back(entry.Future);
+			}
+		}
+	}
+
+	for (auto& future : futures)
+	{
+		future.wait();
+	}
+}
+
+RHIShaderBytecodeCacheStatistics RHIShaderBytecodeCache::GetStatistics()
+{
+	unique_lock lock(_lock);
+	return _statistics;
+}
+
+uint64 RHIShaderBytecodeCache::ComputeHash(const RHIShaderSource& source, string_view compilerIdentity)
+{
+	uint64 hash = FNV_Basis;
+	hash = HashString(hash, compilerIdentity);
+	hash = HashString(hash, source.Source);
+	hash = HashString(hash, source.EntryPoint);
+	hash = HashString(hash, source.Target);
+
+	uint64 numDefines = source.Defines.size();
+	hash = HashBytes(hash, &numDefines, sizeof(numDefines));
+	for (auto& define : source.Defines)
+	{
+		hash = HashString(hash, define.Name);
+		hash = HashString(hash, define.Definition);
+	}
+
+	return hash;
+}
+
+void RHIShaderBytecodeCache::CompileEntry(uint64 hash, Entry* entry)
+{
+	vector<uint8> bytecode;
+	if (LoadBytecode(hash, bytecode))
+	{
+		unique_lock lock(_lock);
+		++_statistics.NumDiskHits;
+	}
+	else
+	{
+		steady_clock::time_point begin = steady_clock::now();
+		string message;
+		bool bSucceeded = false;
+
+		// Promise must be satisfied even if compiler throws, or waiters block forever.
+		try
+		{
+			bSucceeded = _compiler->Compile(entry->Source, bytecode, message);
+		}
+		catch (const exception& e)
+		{
+			message = e.what();
+		}
+		catch (...)
+		{
+			message = "Unknown exception is thrown by shader compiler.";
+		}
+
+		duration<float> elapsed = steady_clock::now() - begin;
+
+		if (!message.empty())
+		{
+			LogSystem::Log(LogRHI, bSucceeded ? Warning : Error, L"{}: {}", entry->Source.Name, StringUtils::AsUnicode(message));
+		}
+
+		if (bSucceeded)
+		{
+			SaveBytecode(hash, bytecode);
+		}
+		else
+		{
+			bytecode.clear();
+		}
+
+		unique_lock lock(_lock);
+		++(bSucceeded ? _statistics.NumCompiled : _statistics.NumFailed);
+		_statistics.CompileTime += elapsed;
+	}
+
+	entry->Promise.set_value(move(bytecode));
+}
+
+bool RHIShaderBytecodeCache::LoadBytecode(uint64 hash, vector<uint8>& outBytecode) const
+{
+	if (_directory.empty())
+	{
+		return false;
+	}
+
+	ifstream stream(GetBytecodePath(hash), ios::binary | ios::ate);
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	streamsize size = stream.tellg();
+	if (size <= 0)
+	{
+		return false;
+	}
+
+	outBytecode.resize((size_t)size);
+	stream.seekg(0);
+	stream.read((char*)outBytecode.data(), size);
+	if (!stream)
+	{
+		outBytecode.clear();
+		return false;
+	}
+
+	return true;
+}
+
+void RHIShaderBytecodeCache::SaveBytecode(uint64 hash, span<uint8 const> bytecode) const
+{
+	if (_directory.empty())
+	{
+		return;
+	}
+
+	// Write to temporary file and rename it, so other process does not read partially written file.
+	filesystem::path filepath = GetBytecodePath(hash);
+	filesystem::path temppath = filepath;
+	temppath += L".tmp";
+
+	{
+		ofstream stream(temppath, ios::binary | ios::trunc);
+		if (!stream.is_open())
+		{
+			LogSystem::Log<Warning>(LogRHI, L"Could not open shader cache file to write.");
+			return;
+		}
+
+		stream.write((const char*)bytecode.data(), (streamsize)bytecode.size());
+		if (!stream)
+		{
+			LogSystem::Log<Warning>(LogRHI, L"Could not write shader cache file.");
+			return;
+		}
+	}
+
+	error_code ec;
+	filesystem::rename(temppath, filepath, ec);
+	if (ec)
+	{
+		filesystem::remove(temppath, ec);
+	}
+}
+
+filesystem::path RHIShaderBytecodeCache::GetBytecodePath(uint64 hash) const
+{
+	return _directory / format(L"{:016X}.cso", hash);
+}
\ No newline at end of file
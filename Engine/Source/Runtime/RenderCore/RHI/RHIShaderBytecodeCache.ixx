@@ -0,0 +1,120 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIShaderBytecodeCache;
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import :RHIShaderCompiler;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents counts of shader bytecode requests that resolved by cache.
+/// </summary>
+export struct RHIShaderBytecodeCacheStatistics
+{
+	/// <summary>
+	/// Count of registered shaders that share bytecode with already registered shader.
+	/// </summary>
+	uint64 NumMemoryHits = 0;
+
+	/// <summary>
+	/// Count of shaders that loaded bytecode from disk cache.
+	/// </summary>
+	uint64 NumDiskHits = 0;
+
+	/// <summary>
+	/// Count of shaders that compiled by compiler.
+	/// </summary>
+	uint64 NumCompiled = 0;
+
+	/// <summary>
+	/// Count of shaders that failed to compile.
+	/// </summary>
+	uint64 NumFailed = 0;
+
+	/// <summary>
+	/// Total time elapsed to compile shaders. Compile time of each shader is summed, so it could be longer than wall time.
+	/// </summary>
+	duration<float> CompileTime = 0ns;
+};
+
+/// <summary>
+/// Represents cache of shader bytecode keyed by hash of HLSL source, defines and compiler identity.
+/// Registered shaders are compiled in parallel on <see cref="JobSystem"/>, and compiled bytecode is persisted to cache directory that later runs load.
+/// </summary>
+export class RHIShaderBytecodeCache : virtual public Object
+{
+public:
+	using Super = Object;
+
+	/// <summary>
+	/// Represents future of compiled bytecode. Bytecode is empty if compile is failed or compiler throws exception.
+	/// </summary>
+	using BytecodeFuture = shared_future<vector<uint8>>;
+
+private:
+	struct Entry
+	{
+		RHIShaderSource Source;
+		promise<vector<uint8>> Promise;
+		BytecodeFuture Future;
+		bool bScheduled = false;
+	};
+
+	IRHIShaderCompiler* const _compiler;
+	const string _compilerIdentity;
+	const filesystem::path _directory;
+
+	mutex _lock;
+	unordered_map<uint64, Entry> _entries;
+	vector<uint64> _pendings;
+	RHIShaderBytecodeCacheStatistics _statistics;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIShaderBytecodeCache"/> instance.
+	/// </summary>
+	/// <param name="compiler"> The shader compiler. </param>
+	/// <param name="directory"> The directory that bytecode files are stored. Disk cache is disabled if empty. </param>
+	RHIShaderBytecodeCache(IRHIShaderCompiler* compiler, const filesystem::path& directory);
+	~RHIShaderBytecodeCache() override;
+
+	/// <summary>
+	/// Register shader source to compile. Compile is deferred until <see cref="CompileAll"/> is called.
+	/// </summary>
+	/// <param name="source"> The shader source. </param>
+	/// <returns> The future of bytecode. Identical sources share same future. </returns>
+	BytecodeFuture Register(RHIShaderSource source);
+
+	/// <summary>
+	/// Schedule all registered shaders that are not scheduled yet to compile on worker threads.
+	/// </summary>
+	void CompileAll();
+
+	/// <summary>
+	/// Wait until all scheduled shaders are compiled.
+	/// </summary>
+	void WaitAll();
+
+	/// <summary>
+	/// Get counts of requests.
+	/// </summary>
+	RHIShaderBytecodeCacheStatistics GetStatistics();
+
+	/// <summary>
+	/// Compute hash of shader source, entry point, target and defines.
+	/// </summary>
+	/// <param name="source"> The shader source. </param>
+	/// <param name="compilerIdentity"> The identity of compiler. Bytecode that compiled by other version or flags makes different hash. </param>
+	static uint64 ComputeHash(const RHIShaderSource& source, string_view compilerIdentity);
+
+private:
+	void CompileEntry(uint64 hash, Entry* entry);
+	bool LoadBytecode(uint64 hash, vector<uint8>& outBytecode) const;
+	void SaveBytecode(uint64 hash, span<uint8 const> bytecode) const;
+	filesystem::path GetBytecodePath(uint64 hash) const;
+};
\ No newline at end of file
@@ -0,0 +1,96 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIShaderCompiler;
+
+import std.core;
+import SC.Runtime.Core;
+
+using namespace std;
+
+/// <summary>
+/// Represents preprocessor macro that defined when shader source is compiled.
+/// </summary>
+export struct RHIShaderMacro
+{
+	/// <summary>
+	/// The macro name.
+	/// </summary>
+	string Name;
+
+	/// <summary>
+	/// The macro definition.
+	/// </summary>
+	string Definition;
+};
+
+/// <summary>
+/// Represents HLSL source of single shader stage.
+/// </summary>
+export struct RHIShaderSource
+{
+	/// <summary>
+	/// The name of source that used to print compile messages.
+	/// </summary>
+	wstring Name;
+
+	/// <summary>
+	/// The HLSL source code.
+	/// </summary>
+	string Source;
+
+	/// <summary>
+	/// The entry point function name.
+	/// </summary>
+	string EntryPoint = "main";
+
+	/// <summary>
+	/// The shader target profile. For example, vs_5_0.
+	/// </summary>
+	string Target;
+
+	/// <summary>
+	/// The preprocessor macros.
+	/// </summary>
+	vector<RHIShaderMacro> Defines;
+};
+
+/// <summary>
+/// Provide interface for compile HLSL source to bytecode. Compile can be called from multiple threads concurrently.
+/// </summary>
+export struct IRHIShaderCompiler : virtual public Object
+{
+	/// <summary>
+	/// Compile shader source.
+	/// </summary>
+	/// <param name="source"> The shader source. </param>
+	/// <param name="outBytecode"> The compiled bytecode. </param>
+	/// <param name="outMessage"> The error or warning messages of compiler. </param>
+	/// <returns> Return false if compile is failed. </returns>
+	virtual bool Compile(const RHIShaderSource& source, vector<uint8>& outBytecode, string& outMessage) = 0;
+
+	/// <summary>
+	/// Get identity of compiler that includes version and flags, which changes generated bytecode.
+	/// </summary>
+	virtual string GetIdentity() const = 0;
+};
+
+/// <summary>
+/// Represents shader compiler that use D3DCompiler library.
+/// </summary>
+export class RHIShaderCompilerD3D : virtual public Object, virtual public IRHIShaderCompiler
+{
+public:
+	using Super = Object;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIShaderCompilerD3D"/> instance.
+	/// </summary>
+	RHIShaderCompilerD3D();
+
+	/// <inheritdoc/>
+	virtual bool Compile(const RHIShaderSource& source, vector<uint8>& outBytecode, string& outMessage) override;
+
+	/// <inheritdoc/>
+	virtual string GetIdentity() const override;
+};
\ No newline at end of file
@@ -0,0 +1,67 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+#include "Internal.h"
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+
+namespace
+{
+	UINT GetCompileFlags()
+	{
+		UINT flags = D3DCOMPILE_ENABLE_STRICTNESS;
+#if defined(_DEBUG)
+		flags |= D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
+#else
+		flags |= D3DCOMPILE_OPTIMIZATION_LEVEL3;
+#endif
+		return flags;
+	}
+}
+
+RHIShaderCompilerD3D::RHIShaderCompilerD3D() : Super()
+{
+}
+
+bool RHIShaderCompilerD3D::Compile(const RHIShaderSource& source, vector<uint8>& outBytecode, string& outMessage)
+{
+	// Macro array is terminated by null entry.
+	vector<D3D_SHADER_MACRO> macros;
+	macros.reserve(source.Defines.size() + 1);
+	for (auto& define : source.Defines)
+	{
+		macros.emplace_back() =
+		{
+			.Name = define.Name.c_str(),
+			.Definition = define.Definition.c_str()
+		};
+	}
+	macros.emplace_back() = {};
+
+	UINT flags = GetCompileFlags();
+	string sourceName = StringUtils::AsMultibyte(source.Name);
+	ComPtr<ID3DBlob> blob, error;
+	HRESULT hr = D3DCompile(source.Source.c_str(), source.Source.length(), sourceName.c_str(), macros.data(), D3D_COMPILE_STANDARD_FILE_INCLUDE, source.EntryPoint.c_str(), source.Target.c_str(), flags, 0, &blob, &error);
+
+	if (error.IsSet())
+	{
+		outMessage.assign((const char*)error->GetBufferPointer(), error->GetBufferSize());
+	}
+
+	if (FAILED(hr))
+	{
+		return false;
+	}
+
+	auto* bytes = (const uint8*)blob->GetBufferPointer();
+	outBytecode.assign(bytes, bytes + blob->GetBufferSize());
+	return true;
+}
+
+string RHIShaderCompilerD3D::GetIdentity() const
+{
+	return format("D3DCompiler_{};Flags={:08X}", D3D_COMPILER_VERSION, GetCompileFlags());
+}
\ No newline at end of file
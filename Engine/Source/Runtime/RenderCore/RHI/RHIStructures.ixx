@@ -21,6 +21,8 @@ export struct RHIViewport
 	float Height = 0;
 	float MinDepth = 0;
 	float MaxDepth = 0;
+
+	constexpr bool operator ==(const RHIViewport& rhs) const = default;
 };
 
 /// <summary>
@@ -32,6 +34,8 @@ export struct RHIScissorRect
 	int32 Top = 0;
 	int32 Right = 0;
 	int32 Bottom = 0;
+
+	constexpr bool operator ==(const RHIScissorRect& rhs) const = default;
 };
 
 /// <summary>
@@ -110,6 +114,8 @@ export struct RHIVertexBufferView
 	uint64 BufferLocation = 0;
 	uint32 SizeInBytes = 0;
 	uint32 StrideInBytes = 0;
+
+	constexpr bool operator ==(const RHIVertexBufferView& rhs) const = default;
 };
 
 /// <summary>
@@ -139,4 +145,19 @@ export struct RHIViewConstants
 	Matrix4x4 WorldViewProj;
 };
 
-#pragma pack(pop)
\ No newline at end of file
+#pragma pack(pop)
+
+/// <summary>
+/// Represents counts of commands that device contexts recorded and queues submitted.
+/// </summary>
+export struct RHIDeviceStatistics
+{
+	uint64 NumCommands = 0;
+	uint64 NumElidedCommands = 0;
+	uint64 NumDrawCalls = 0;
+	uint64 NumBarriers = 0;
+	uint64 NumElidedBarriers = 0;
+	uint64 NumExecutedDeviceContexts = 0;
+	uint64 NumPresents = 0;
+	uint64 NumUploadedBytes = 0;
+};
\ No newline at end of file
@@ -7,6 +7,11 @@ import SC.Runtime.RenderCore;
 
 RHISwapChain::RHISwapChain(RHIDevice* device, IWindowView* view, RHICommandQueue* queue) : Super(device)
 {
+	if (device->IsNullDevice())
+	{
+		return;
+	}
+
 	IDXGIFactory2* dxgi = device->GetFactory();
 
 	DXGI_SWAP_CHAIN_DESC1 chainDesc =
@@ -34,6 +39,13 @@ RHISwapChain::~RHISwapChain()
 
 void RHISwapChain::Present(uint8 vSyncLevel)
 {
+	GetDevice()->AccumulateStatistics({ .NumPresents = 1 });
+	if (!_swapChain.IsSet())
+	{
+		_nullBackBufferIndex = (_nullBackBufferIndex + 1) % 3;
+		return;
+	}
+
 	HR_E(LogRHI, _swapChain->Present((UINT)vSyncLevel, 0));
 }
 
@@ -48,6 +60,17 @@ void RHISwapChain::ResizeBuffers(int32 width, int32 height)
 		}
 	}
 
+	if (!_swapChain.IsSet())
+	{
+		for (int32 i = 0; i < 3; ++i)
+		{
+			_buffers[i] = CreateSubobject<RHITexture2D>(GetDevice(), width, height);
+		}
+
+		_nullBackBufferIndex = 0;
+		return;
+	}
+
 	HR_E(LogRHI, _swapChain->ResizeBuffers(0, (UINT)width, (UINT)height, DXGI_FORMAT_UNKNOWN, 0));
 
 	for (int32 i = 0; i < 3; ++i)
@@ -65,5 +88,10 @@ RHITexture2D* RHISwapChain::GetBuffer(int32 index) const
 
 int32 RHISwapChain::GetCurrentBackBufferIndex() const
 {
+	if (!_swapChain.IsSet())
+	{
+		return _nullBackBufferIndex;
+	}
+
 	return (int32)_swapChain->GetCurrentBackBufferIndex();
 }
\ No newline at end of file
@@ -23,13 +23,14 @@ public:
 private:
 	ComPtr<IDXGISwapChain4> _swapChain;
 	RHITexture2D* _buffers[3] = {};
+	int32 _nullBackBufferIndex = 0;
 
 public:
 	/// <summary>
 	/// Initialize new <see cref="RHISwapChain"/> instance.
 	/// </summary>
 	/// <param name="device"> The logical device. </param>
-	/// <param name="view"> The render target view. </param>
+	/// <param name="view"> The render target view. Ignored on null device. </param>
 	/// <param name="queue"> Specify command queue that swap chain be presenting. </param>
 	RHISwapChain(RHIDevice* device, IWindowView* view, RHICommandQueue* queue);
 	~RHISwapChain() override;
@@ -5,7 +5,7 @@
 import SC.Runtime.Core;
 import SC.Runtime.RenderCore;
 
-RHITexture::RHITexture(RHIDevice* device, ID3D12Resource* resource) : Super(device, resource)
+RHITexture::RHITexture(RHIDevice* device, ID3D12Resource* resource, uint64 nullSize, ERHIResourceStates initialState) : Super(device, resource, nullSize, initialState)
 {
 }
 
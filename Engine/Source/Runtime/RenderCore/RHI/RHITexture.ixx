@@ -13,6 +13,6 @@ public:
 	using Super = RHIResource;
 
 public:
-	RHITexture(RHIDevice* device, ID3D12Resource* resource);
+	RHITexture(RHIDevice* device, ID3D12Resource* resource, uint64 nullSize = 0, ERHIResourceStates initialState = ERHIResourceStates::Common);
 	~RHITexture() override;
 };
\ No newline at end of file
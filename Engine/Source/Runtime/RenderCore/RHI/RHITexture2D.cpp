@@ -5,7 +5,13 @@
 import SC.Runtime.RenderCore;
 import SC.Runtime.Core;
 
-RHITexture2D::RHITexture2D(RHIDevice* device, ID3D12Resource* resource) : Super(device, resource)
+RHITexture2D::RHITexture2D(RHIDevice* device, ID3D12Resource* resource, ERHIResourceStates initialState) : Super(device, resource, 0, initialState)
+{
+}
+
+RHITexture2D::RHITexture2D(RHIDevice* device, int32 width, int32 height, ERHIResourceStates initialState) : Super(device, nullptr, 0, initialState)
+	, _nullWidth(width)
+	, _nullHeight(height)
 {
 }
 
@@ -15,6 +21,19 @@ RHITexture2D::~RHITexture2D()
 
 void RHITexture2D::GetPixelSize(int32* pWidth, int32* pHeight)
 {
+	if (GetResource() == nullptr)
+	{
+		if (pWidth != nullptr)
+		{
+			*pWidth = _nullWidth;
+		}
+		if (pHeight != nullptr)
+		{
+			*pHeight = _nullHeight;
+		}
+		return;
+	}
+
 	D3D12_RESOURCE_DESC desc = GetResource()->GetDesc();
 	if (pWidth != nullptr)
 	{
@@ -12,8 +12,17 @@ export class RHITexture2D : public RHITexture
 public:
 	using Super = RHITexture;
 
+private:
+	int32 _nullWidth = 0;
+	int32 _nullHeight = 0;
+
 public:
-	RHITexture2D(RHIDevice* device, ID3D12Resource* resource);
+	RHITexture2D(RHIDevice* device, ID3D12Resource* resource, ERHIResourceStates initialState = ERHIResourceStates::Common);
+
+	/// <summary>
+	/// Initialize new <see cref="RHITexture2D"/> instance on null device.
+	/// </summary>
+	RHITexture2D(RHIDevice* device, int32 width, int32 height, ERHIResourceStates initialState = ERHIResourceStates::Common);
 	~RHITexture2D() override;
 
 	/// <summary>
@@ -0,0 +1,111 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+#include "Internal.h"
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+RHIUploadRingBuffer::RHIUploadRingBuffer(RHIDevice* device, RHICommandQueue* queue, uint64 capacity) : Super(device)
+	, _queue(queue)
+	, _capacity(capacity)
+{
+	_buffer = device->CreateDynamicBuffer((size_t)capacity);
+	{
+		unique_lock lock(device->GetSubobjectLock());
+		_buffer->SetOuter(this);
+	}
+	_gpuAddress = _buffer->GetGPUVirtualAddress();
+
+	if (ID3D12Resource* resource = _buffer->GetResource(); resource != nullptr)
+	{
+		// Upload heap can be mapped persistently.
+		void* mapped = nullptr;
+		HR(LogRHI, resource->Map(0, nullptr, &mapped));
+		_cpuAddress = (uint8*)mapped;
+	}
+	else
+	{
+		_nullMemory = make_unique<uint8[]>((size_t)capacity);
+		_cpuAddress = _nullMemory.get();
+	}
+}
+
+RHIUploadRingBuffer::~RHIUploadRingBuffer()
+{
+	if (ID3D12Resource* resource = _buffer->GetResource(); resource != nullptr)
+	{
+		resource->Unmap(0, nullptr);
+	}
+}
+
+RHIUploadAllocation RHIUploadRingBuffer::Allocate(uint64 size, uint64 alignment)
+{
+	unique_lock lock(_lock);
+
+	for (int32 attempt = 0; attempt < 2; ++attempt)
+	{
+		uint64 offset = (_head + alignment - 1) & ~(alignment - 1);
+		if (offset + size > _capacity)
+		{
+			// Skip remaining space to end of buffer and wrap around.
+			offset = 0;
+		}
+
+		uint64 padding = offset >= _head ? offset - _head : _capacity - _head;
+		uint64 required = padding + size;
+
+		if (_totalAllocated - _totalReleased + required <= _capacity)
+		{
+			_head = offset + size;
+			_totalAllocated += required;
+
+			return
+			{
+				.CPUAddress = _cpuAddress + offset,
+				.GPUVirtualAddress = _gpuAddress + offset,
+				.Size = size
+			};
+		}
+
+		Reclaim();
+	}
+
+	LogSystem::Log<Error>(LogRHI, L"Upload ring buffer is full. Could not allocate {} bytes. Capacity: {} bytes.", size, _capacity);
+	return {};
+}
+
+uint64 RHIUploadRingBuffer::CloseFrame()
+{
+	unique_lock lock(_lock);
+	return _totalAllocated;
+}
+
+void RHIUploadRingBuffer::RetireFrame(uint64 frameMarker, uint64 fenceValue)
+{
+	unique_lock lock(_lock);
+	_frames.emplace(FrameMarker{ .FenceValue = fenceValue, .AllocatedBytes = frameMarker });
+	Reclaim();
+}
+
+uint64 RHIUploadRingBuffer::GetUsedBytes()
+{
+	unique_lock lock(_lock);
+	return _totalAllocated - _totalReleased;
+}
+
+void RHIUploadRingBuffer::Reclaim()
+{
+	// Allocations are released in order, so releasing frame releases all allocations before the marker.
+	uint64 completed = _queue->GetCompletedValue();
+	while (!_frames.empty() && _frames.front().FenceValue <= completed)
+	{
+		_totalReleased = max(_totalReleased, _frames.front().AllocatedBytes);
+		_frames.pop();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RHIUploadRingBuffer;
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import :RHIDeviceChild;
+
+using namespace std;
+
+export class RHIDevice;
+export class RHIResource;
+export class RHICommandQueue;
+
+/// <summary>
+/// Represents sub-allocation of upload ring buffer.
+/// </summary>
+export struct RHIUploadAllocation
+{
+	/// <summary>
+	/// The CPU address that mapped. Write data to this address.
+	/// </summary>
+	void* CPUAddress = nullptr;
+
+	/// <summary>
+	/// The GPU virtual address that binding to shader.
+	/// </summary>
+	uint64 GPUVirtualAddress = 0;
+
+	/// <summary>
+	/// The allocated size.
+	/// </summary>
+	uint64 Size = 0;
+
+	/// <summary>
+	/// Indicate allocation is succeeded.
+	/// </summary>
+	bool IsValid() const { return CPUAddress != nullptr; }
+};
+
+/// <summary>
+/// Represents persistently mapped upload buffer that allocate transient data linearly, such as view constants.
+/// Allocations are grouped by frame, and space is recycled when GPU completes the fence value of the frame.
+/// </summary>
+export class RHIUploadRingBuffer : public RHIDeviceChild
+{
+public:
+	using Super = RHIDeviceChild;
+
+	/// <summary>
+	/// The default alignment that satisfies constant buffer placement.
+	/// </summary>
+	static constexpr uint64 DefaultAlignment = 256;
+
+private:
+	struct FrameMarker
+	{
+		uint64 FenceValue = 0;
+		uint64 AllocatedBytes = 0;
+	};
+
+	RHICommandQueue* _queue = nullptr;
+	RHIResource* _buffer = nullptr;
+	uint8* _cpuAddress = nullptr;
+	uint64 _gpuAddress = 0;
+	uint64 _capacity = 0;
+	unique_ptr<uint8[]> _nullMemory;
+
+	mutex _lock;
+	uint64 _head = 0;
+	uint64 _totalAllocated = 0;
+	uint64 _totalReleased = 0;
+	queue<FrameMarker> _frames;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RHIUploadRingBuffer"/> instance.
+	/// </summary>
+	/// <param name="device"> The logical device. </param>
+	/// <param name="queue"> The command queue that frames are submitted. </param>
+	/// <param name="capacity"> The size of buffer. </param>
+	RHIUploadRingBuffer(RHIDevice* device, RHICommandQueue* queue, uint64 capacity);
+	~RHIUploadRingBuffer() override;
+
+	/// <summary>
+	/// Allocate transient data. Allocation is valid until the frame that allocated is completed by GPU.
+	/// </summary>
+	/// <param name="size"> The size of data. </param>
+	/// <param name="alignment"> The alignment of data. Should be power of two. </param>
+	/// <returns> The allocation. Allocation is invalid if buffer is full. </returns>
+	RHIUploadAllocation Allocate(uint64 size, uint64 alignment = DefaultAlignment);
+
+	/// <summary>
+	/// Close allocations of current frame.
+	/// </summary>
+	/// <returns> The marker that represents end of the frame. </returns>
+	uint64 CloseFrame();
+
+	/// <summary>
+	/// Register fence value that signaled after the frame is submitted. Space is recycled after fence value is completed.
+	/// </summary>
+	/// <param name="frameMarker"> The marker that returned by <see cref="CloseFrame"/>. </param>
+	/// <param name="fenceValue"> The fence value. </param>
+	void RetireFrame(uint64 frameMarker, uint64 fenceValue);
+
+	/// <summary>
+	/// Get size of buffer.
+	/// </summary>
+	uint64 GetCapacity() const { return _capacity; }
+
+	/// <summary>
+	/// Get size of space that is in use, include padding.
+	/// </summary>
+	uint64 GetUsedBytes();
+
+private:
+	void Reclaim();
+};
\ No newline at end of file
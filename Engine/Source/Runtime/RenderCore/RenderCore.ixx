@@ -13,6 +13,7 @@ export import :RHIEnums;
 export import :RHICommandQueue;
 export import :RHISwapChain;
 export import :RHIDeviceContext;
+export import :RHIDeviceContextPool;
 export import :RHIShader;
 export import :RHIResource;
 export import :RHITexture;
@@ -20,4 +21,12 @@ export import :RHITexture2D;
 export import :RHIView;
 export import :RHIRenderTargetView;
 export import :RHIStructures;
-export import :RHIVertexFactory;
\ No newline at end of file
+export import :RHIVertexFactory;
+export import :RHIUploadRingBuffer;
+export import :RHIPipelineStateCache;
+export import :RHIShaderCompiler;
+export import :RHIShaderBytecodeCache;
+export import :RHIDescriptorAllocator;
+
+// RenderGraph
+export import :RenderGraph;
\ No newline at end of file
@@ -0,0 +1,599 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+
+using namespace std;
+using namespace std::chrono;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	constexpr ERHIResourceStates ReadOnlyStates =
+		ERHIResourceStates::GENERIC_READ |
+		ERHIResourceStates::DepthRead |
+		ERHIResourceStates::ResolveSource;
+
+	// Committed resources are placed at 64KB granularity.
+	constexpr uint64 ResourcePlacementAlignment = 64 * 1024;
+
+	bool IsReadOnlyState(ERHIResourceStates state)
+	{
+		return state != ERHIResourceStates::Common && (state & ~ReadOnlyStates) == ERHIResourceStates::Common;
+	}
+
+	uint64 GetBytesPerPixel(ERHIPixelFormat format)
+	{
+		int32 value = (int32)format;
+		if (value >= 1 && value <= 4) return 16;
+		if (value >= 5 && value <= 8) return 12;
+		if (value >= 9 && value <= 22) return 8;
+		if (value >= 48 && value <= 59) return 2;
+		if (value >= 60 && value <= 65) return 1;
+		return 4;
+	}
+}
+
+RenderGraphBuilder::RenderGraphBuilder(RenderGraph* graph, int32 passIndex)
+	: _graph(graph)
+	, _passIndex(passIndex)
+{
+}
+
+RenderGraphResourceHandle RenderGraphBuilder::CreateTexture(wstring_view name, const RenderGraphTextureDesc& desc)
+{
+	return _graph->CreateTransient(name,
+	{
+		.Type = ERenderGraphResourceType::Texture,
+		.Texture = desc
+	});
+}
+
+RenderGraphResourceHandle RenderGraphBuilder::CreateBuffer(wstring_view name, const RenderGraphBufferDesc& desc)
+{
+	return _graph->CreateTransient(name,
+	{
+		.Type = ERenderGraphResourceType::Buffer,
+		.Buffer = desc
+	});
+}
+
+RenderGraphResourceHandle RenderGraphBuilder::Read(RenderGraphResourceHandle handle, ERHIResourceStates state)
+{
+	_graph->AddAccess(_passIndex, handle, state, false);
+	return handle;
+}
+
+RenderGraphResourceHandle RenderGraphBuilder::Write(RenderGraphResourceHandle handle, ERHIResourceStates state)
+{
+	_graph->AddAccess(_passIndex, handle, state, true);
+	return handle;
+}
+
+void RenderGraphBuilder::SetSideEffect()
+{
+	_graph->_passes[_passIndex].bSideEffect = true;
+}
+
+RenderGraph::RenderGraph(RHIDevice* device) : Super(device)
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+	// Pooled resources may be referenced by command lists in flight. Queue destroys them on collecting thread.
+	RHICommandQueue* queue = GetDevice()->GetPrimaryQueue();
+	for (auto& pooled : _pool)
+	{
+		queue->AddGarbageObject(queue->GetLastSignalValue(), pooled.Resource);
+	}
+}
+
+RenderGraphResourceHandle RenderGraph::ImportResource(wstring_view name, RHIResource* resource, ERHIResourceStates finalState)
+{
+	if (resource == nullptr)
+	{
+		LogSystem::Log<Error>(LogRHI, L"Resource {} that imported to render graph is nullptr. Abort.", name);
+		return {};
+	}
+
+	RenderGraphResourceHandle handle = { .Index = (int32)_resources.size() };
+	Resource& imported = _resources.emplace_back();
+	imported.Name = name;
+	imported.Imported = resource;
+	imported.FinalState = finalState;
+	_bCompiled = false;
+	return handle;
+}
+
+int32 RenderGraph::AddPass(wstring_view name, SetupFunction setup, ExecuteFunction execute)
+{
+	int32 passIndex = (int32)_passes.size();
+	Pass& pass = _passes.emplace_back();
+	pass.Name = name;
+	pass.Execute = move(execute);
+
+	RenderGraphBuilder builder(this, passIndex);
+	setup(builder);
+
+	_bCompiled = false;
+	return passIndex;
+}
+
+void RenderGraph::Compile()
+{
+	auto begin = steady_clock::now();
+
+	for (auto& pass : _passes)
+	{
+		pass.Barriers.clear();
+		pass.RefCount = 0;
+		pass.bCulled = false;
+	}
+
+	for (auto& resource : _resources)
+	{
+		resource.RefCount = 0;
+		resource.FirstPass = -1;
+		resource.LastPass = -1;
+		resource.PhysicalIndex = -1;
+	}
+
+	_physicals.clear();
+	_finalBarriers.clear();
+	_statistics = {};
+	_statistics.NumPasses = _passes.size();
+
+	CullPasses();
+	ComputeLifetimes();
+	AliasResources();
+	ScheduleBarriers();
+
+	_statistics.CompileTime = steady_clock::now() - begin;
+	_bCompiled = true;
+}
+
+void RenderGraph::Execute(RHIDeviceContext* deviceContext)
+{
+	if (!_bCompiled)
+	{
+		Compile();
+	}
+
+	for (auto& physical : _physicals)
+	{
+		physical.Resource = AcquirePhysical(physical.Desc);
+	}
+
+	// Physical resources carry their tracked states over aliasing and frames,
+	// so device context transitions from actual state and elides barriers that are already satisfied.
+	for (auto& pass : _passes)
+	{
+		if (pass.bCulled)
+		{
+			continue;
+		}
+
+		for (auto& barrier : pass.Barriers)
+		{
+			if (RHIResource* resource = GetResource(barrier.Resource); resource != nullptr)
+			{
+				deviceContext->TransitionState(resource, barrier.StateAfter);
+			}
+		}
+
+		pass.Execute(deviceContext, *this);
+	}
+
+	for (auto& barrier : _finalBarriers)
+	{
+		if (RHIResource* resource = GetResource(barrier.Resource); resource != nullptr)
+		{
+			deviceContext->TransitionState(resource, barrier.StateAfter);
+		}
+	}
+
+	// Commands are executed in order on queue, so physical resources can be reused by next frame without waiting GPU.
+	for (auto& pooled : _pool)
+	{
+		if (pooled.bInUse)
+		{
+			pooled.LastUsedFrame = _frameNumber;
+			pooled.bInUse = false;
+		}
+	}
+
+	for (auto& physical : _physicals)
+	{
+		physical.Resource = nullptr;
+	}
+}
+
+void RenderGraph::RetireFrame(uint64 fenceValue)
+{
+	// Graph is executed on render thread. Released resources are handed to garbage list of queue,
+	// that game thread drains, instead of being destroyed here.
+	RHICommandQueue* queue = GetDevice()->GetPrimaryQueue();
+	for (auto it = _pool.begin(); it != _pool.end();)
+	{
+		if (_frameNumber - it->LastUsedFrame >= MaxUnusedFrames)
+		{
+			queue->AddGarbageObject(fenceValue, it->Resource);
+			it = _pool.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	++_frameNumber;
+}
+
+void RenderGraph::Reset()
+{
+	_passes.clear();
+	_resources.clear();
+	_physicals.clear();
+	_finalBarriers.clear();
+	_bCompiled = false;
+}
+
+RHIResource* RenderGraph::GetResource(RenderGraphResourceHandle handle) const
+{
+	const Resource& resource = _resources[handle.Index];
+	if (resource.Imported != nullptr)
+	{
+		return resource.Imported;
+	}
+
+	if (resource.PhysicalIndex == -1)
+	{
+		return nullptr;
+	}
+
+	return _physicals[resource.PhysicalIndex].Resource;
+}
+
+RenderGraphResourceHandle RenderGraph::CreateTransient(wstring_view name, const ResourceDesc& desc)
+{
+	RenderGraphResourceHandle handle = { .Index = (int32)_resources.size() };
+	Resource& transient = _resources.emplace_back();
+	transient.Name = name;
+	transient.Desc = desc;
+	return handle;
+}
+
+void RenderGraph::AddAccess(int32 passIndex, RenderGraphResourceHandle handle, ERHIResourceStates state, bool bWrite)
+{
+	if (!handle.IsValid() || handle.Index >= (int32)_resources.size())
+	{
+		LogSystem::Log<Error>(LogRHI, L"Pass {} declares access to invalid resource handle. Abort.", _passes[passIndex].Name);
+		return;
+	}
+
+	Pass& pass = _passes[passIndex];
+	pass.Accesses.emplace_back(ResourceAccess
+	{
+		.Resource = handle,
+		.State = state,
+		.bWrite = bWrite
+	});
+
+	if (bWrite)
+	{
+		_resources[handle.Index].Producers.emplace_back(passIndex);
+	}
+}
+
+void RenderGraph::CullPasses()
+{
+	// Pass is referenced by resources it writes, and resource is referenced by passes that read it.
+	// Read of resource that pass also writes does not reference resource, or pass keeps itself alive.
+	for (int32 i = 0; i < (int32)_passes.size(); ++i)
+	{
+		Pass& pass = _passes[i];
+		for (auto& access : pass.Accesses)
+		{
+			if (access.bWrite)
+			{
+				pass.RefCount += 1;
+			}
+			else if (ranges::find(_resources[access.Resource.Index].Producers, i) == _resources[access.Resource.Index].Producers.end())
+			{
+				_resources[access.Resource.Index].RefCount += 1;
+			}
+		}
+
+		if (pass.bSideEffect)
+		{
+			pass.RefCount += 1;
+		}
+	}
+
+	vector<int32> unreferenced;
+	for (int32 i = 0; i < (int32)_resources.size(); ++i)
+	{
+		Resource& resource = _resources[i];
+		if (resource.Imported != nullptr)
+		{
+			// Imported resources are read outside of graph.
+			resource.RefCount += 1;
+		}
+		else if (resource.RefCount == 0)
+		{
+			unreferenced.emplace_back(i);
+		}
+	}
+
+	auto cullPass = [&](int32 passIndex)
+	{
+		Pass& pass = _passes[passIndex];
+		pass.bCulled = true;
+		_statistics.NumCulledPasses += 1;
+
+		for (auto& access : pass.Accesses)
+		{
+			Resource& resource = _resources[access.Resource.Index];
+			if (!access.bWrite && ranges::find(resource.Producers, passIndex) == resource.Producers.end())
+			{
+				if (--resource.RefCount == 0)
+				{
+					unreferenced.emplace_back(access.Resource.Index);
+				}
+			}
+		}
+	};
+
+	for (int32 i = 0; i < (int32)_passes.size(); ++i)
+	{
+		if (_passes[i].RefCount == 0)
+		{
+			cullPass(i);
+		}
+	}
+
+	while (!unreferenced.empty())
+	{
+		int32 resourceIndex = unreferenced.back();
+		unreferenced.pop_back();
+
+		for (int32 producer : _resources[resourceIndex].Producers)
+		{
+			Pass& pass = _passes[producer];
+			if (!pass.bCulled && --pass.RefCount == 0)
+			{
+				cullPass(producer);
+			}
+		}
+	}
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+	for (int32 i = 0; i < (int32)_passes.size(); ++i)
+	{
+		Pass& pass = _passes[i];
+		if (pass.bCulled)
+		{
+			continue;
+		}
+
+		for (auto& access : pass.Accesses)
+		{
+			Resource& resource = _resources[access.Resource.Index];
+			if (resource.FirstPass == -1)
+			{
+				resource.FirstPass = i;
+			}
+			resource.LastPass = i;
+
+			// Physical resource must allow all usages of transient resource.
+			if ((access.State & ERHIResourceStates::RenderTarget) != ERHIResourceStates::Common)
+			{
+				resource.Desc.Flags |= ERHIResourceFlags::AllowRenderTarget;
+			}
+			if ((access.State & (ERHIResourceStates::DepthWrite | ERHIResourceStates::DepthRead)) != ERHIResourceStates::Common)
+			{
+				resource.Desc.Flags |= ERHIResourceFlags::AllowDepthStencil;
+			}
+			if ((access.State & ERHIResourceStates::UnorderedAccess) != ERHIResourceStates::Common)
+			{
+				resource.Desc.Flags |= ERHIResourceFlags::AllowUnorderedAccess;
+			}
+		}
+	}
+}
+
+void RenderGraph::AliasResources()
+{
+	vector<int32> transients;
+	for (int32 i = 0; i < (int32)_resources.size(); ++i)
+	{
+		if (_resources[i].Imported == nullptr && _resources[i].FirstPass != -1)
+		{
+			transients.emplace_back(i);
+		}
+	}
+
+	ranges::stable_sort(transients, [this](int32 lh, int32 rh)
+	{
+		return _resources[lh].FirstPass < _resources[rh].FirstPass;
+	});
+
+	auto getBytes = [](const ResourceDesc& desc)
+	{
+		uint64 bytes = desc.Type == ERenderGraphResourceType::Texture
+			? (uint64)desc.Texture.Width * (uint64)desc.Texture.Height * GetBytesPerPixel(desc.Texture.Format)
+			: desc.Buffer.Size;
+		return (bytes + ResourcePlacementAlignment - 1) / ResourcePlacementAlignment * ResourcePlacementAlignment;
+	};
+
+	// Transient resource reuses physical resource that is compatible and whose last user precedes first user of transient resource.
+	for (int32 resourceIndex : transients)
+	{
+		Resource& resource = _resources[resourceIndex];
+		uint64 bytes = getBytes(resource.Desc);
+		_statistics.TransientBytes += bytes;
+
+		auto it = ranges::find_if(_physicals, [&resource](const PhysicalResource& physical)
+		{
+			return physical.Desc == resource.Desc && physical.LastPass < resource.FirstPass;
+		});
+
+		if (it == _physicals.end())
+		{
+			_physicals.emplace_back(PhysicalResource{ .Desc = resource.Desc });
+			it = _physicals.end() - 1;
+			_statistics.AliasedBytes += bytes;
+		}
+
+		it->LastPass = resource.LastPass;
+		resource.PhysicalIndex = (int32)(it - _physicals.begin());
+	}
+
+	_statistics.NumTransientResources = transients.size();
+	_statistics.NumPhysicalResources = _physicals.size();
+}
+
+void RenderGraph::ScheduleBarriers()
+{
+	struct PlannedState
+	{
+		ERHIResourceStates State = ERHIResourceStates::Common;
+		int32 ReadPass = -1;
+		size_t ReadBarrier = 0;
+		uint8 bKnown : 1 = true;
+	};
+
+	// Transient resources start from common state. Actual states of resources are resolved by device context at submission.
+	// Imported resource whose subresources are in different states has unknown state, so its first access always transitions.
+	vector<PlannedState> planned(_resources.size());
+	for (size_t i = 0; i < _resources.size(); ++i)
+	{
+		if (RHIResource* imported = _resources[i].Imported; imported != nullptr)
+		{
+			optional<ERHIResourceStates> state = imported->GetState();
+			planned[i].State = state.value_or(ERHIResourceStates::Common);
+			planned[i].bKnown = state.has_value();
+		}
+	}
+
+	vector<ResourceAccess> merged;
+	for (int32 i = 0; i < (int32)_passes.size(); ++i)
+	{
+		Pass& pass = _passes[i];
+		if (pass.bCulled)
+		{
+			continue;
+		}
+
+		// Multiple accesses of pass to same resource require combined state.
+		merged.clear();
+		for (auto& access : pass.Accesses)
+		{
+			auto it = ranges::find(merged, access.Resource, &ResourceAccess::Resource);
+			if (it == merged.end())
+			{
+				merged.emplace_back(access);
+			}
+			else
+			{
+				it->State |= access.State;
+				it->bWrite |= access.bWrite;
+			}
+		}
+
+		for (auto& access : merged)
+		{
+			PlannedState& current = planned[access.Resource.Index];
+			if (current.bKnown && current.State == access.State)
+			{
+				continue;
+			}
+
+			bool bRead = !access.bWrite && IsReadOnlyState(access.State);
+			if (current.bKnown && bRead && IsReadOnlyState(current.State))
+			{
+				if ((current.State & access.State) == access.State)
+				{
+					continue;
+				}
+
+				// Consecutive reads in different states share one transition to combined read state.
+				if (current.ReadPass != -1)
+				{
+					current.State |= access.State;
+					_passes[current.ReadPass].Barriers[current.ReadBarrier].StateAfter = current.State;
+					continue;
+				}
+			}
+
+			pass.Barriers.emplace_back(RenderGraphBarrier
+			{
+				.Resource = access.Resource,
+				.StateBefore = current.State,
+				.StateAfter = access.State
+			});
+
+			current.State = access.State;
+			current.bKnown = true;
+			current.ReadPass = bRead ? i : -1;
+			current.ReadBarrier = pass.Barriers.size() - 1;
+		}
+
+		_statistics.NumBarriers += pass.Barriers.size();
+	}
+
+	for (int32 i = 0; i < (int32)_resources.size(); ++i)
+	{
+		Resource& resource = _resources[i];
+		if (resource.Imported != nullptr && (!planned[i].bKnown || planned[i].State != resource.FinalState))
+		{
+			_finalBarriers.emplace_back(RenderGraphBarrier
+			{
+				.Resource = { .Index = i },
+				.StateBefore = planned[i].State,
+				.StateAfter = resource.FinalState
+			});
+		}
+	}
+
+	_statistics.NumBarriers += _finalBarriers.size();
+}
+
+RHIResource* RenderGraph::AcquirePhysical(const ResourceDesc& desc)
+{
+	for (auto& pooled : _pool)
+	{
+		if (!pooled.bInUse && pooled.Desc == desc)
+		{
+			pooled.bInUse = true;
+			return pooled.Resource;
+		}
+	}
+
+	// Device creates resources under its subobject lock, so render thread can create them while game thread collects garbages.
+	RHIDevice* device = GetDevice();
+	RHIResource* resource = nullptr;
+	if (desc.Type == ERenderGraphResourceType::Texture)
+	{
+		resource = device->CreateTexture2D(desc.Texture.Width, desc.Texture.Height, desc.Texture.Format, desc.Flags, ERHIResourceStates::Common);
+	}
+	else
+	{
+		resource = device->CreateBuffer(desc.Buffer.Size, desc.Flags, ERHIResourceStates::Common);
+	}
+
+	_pool.emplace_back(PooledResource
+	{
+		.Desc = desc,
+		.Resource = resource,
+		.LastUsedFrame = _frameNumber,
+		.bInUse = true
+	});
+
+	return resource;
+}
\ No newline at end of file
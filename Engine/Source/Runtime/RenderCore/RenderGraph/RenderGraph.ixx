@@ -0,0 +1,344 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Runtime.RenderCore:RenderGraph;
+
+import std.core;
+import SC.Runtime.Core;
+import :RHIEnums;
+import :RHIDeviceChild;
+
+using namespace std;
+using namespace std::chrono;
+
+export class RHIDevice;
+export class RHIResource;
+export class RHIDeviceContext;
+export class RenderGraph;
+
+/// <summary>
+/// Specifies the type of render graph resource.
+/// </summary>
+export enum class ERenderGraphResourceType
+{
+	/// <summary>
+	/// The 2D texture.
+	/// </summary>
+	Texture = 0,
+
+	/// <summary>
+	/// The buffer.
+	/// </summary>
+	Buffer = 1,
+};
+
+/// <summary>
+/// Represents handle of resource that declared to render graph.
+/// </summary>
+export struct RenderGraphResourceHandle
+{
+	/// <summary>
+	/// The index of resource in graph.
+	/// </summary>
+	int32 Index = -1;
+
+	/// <summary>
+	/// Indicate handle refers resource.
+	/// </summary>
+	bool IsValid() const { return Index >= 0; }
+
+	bool operator ==(const RenderGraphResourceHandle&) const = default;
+};
+
+/// <summary>
+/// Represents description of transient texture.
+/// </summary>
+export struct RenderGraphTextureDesc
+{
+	int32 Width = 0;
+	int32 Height = 0;
+	ERHIPixelFormat Format = ERHIPixelFormat::Unknown;
+
+	bool operator ==(const RenderGraphTextureDesc&) const = default;
+};
+
+/// <summary>
+/// Represents description of transient buffer.
+/// </summary>
+export struct RenderGraphBufferDesc
+{
+	uint64 Size = 0;
+
+	bool operator ==(const RenderGraphBufferDesc&) const = default;
+};
+
+/// <summary>
+/// Represents state transition that compiled render graph records before pass.
+/// </summary>
+export struct RenderGraphBarrier
+{
+	RenderGraphResourceHandle Resource;
+	ERHIResourceStates StateBefore = ERHIResourceStates::Common;
+	ERHIResourceStates StateAfter = ERHIResourceStates::Common;
+};
+
+/// <summary>
+/// Represents result of render graph compilation.
+/// </summary>
+export struct RenderGraphStatistics
+{
+	/// <summary>
+	/// The count of passes that added to graph.
+	/// </summary>
+	size_t NumPasses = 0;
+
+	/// <summary>
+	/// The count of passes that culled because nobody reads their outputs.
+	/// </summary>
+	size_t NumCulledPasses = 0;
+
+	/// <summary>
+	/// The count of transient resources that used by executed passes.
+	/// </summary>
+	size_t NumTransientResources = 0;
+
+	/// <summary>
+	/// The count of physical resources that transient resources are aliased to.
+	/// </summary>
+	size_t NumPhysicalResources = 0;
+
+	/// <summary>
+	/// The count of barriers that compiled graph records.
+	/// </summary>
+	size_t NumBarriers = 0;
+
+	/// <summary>
+	/// The estimated size of transient resources in bytes if they are not aliased.
+	/// </summary>
+	uint64 TransientBytes = 0;
+
+	/// <summary>
+	/// The estimated size of physical resources in bytes.
+	/// </summary>
+	uint64 AliasedBytes = 0;
+
+	/// <summary>
+	/// The elapsed time of last compilation.
+	/// </summary>
+	duration<float> CompileTime = 0s;
+};
+
+/// <summary>
+/// Provide functions that declare resources and their usages of pass at setup.
+/// </summary>
+export class RenderGraphBuilder
+{
+	RenderGraph* const _graph;
+	const int32 _passIndex;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RenderGraphBuilder"/> instance.
+	/// </summary>
+	RenderGraphBuilder(RenderGraph* graph, int32 passIndex);
+
+	/// <summary>
+	/// Create transient texture that lives only in graph.
+	/// </summary>
+	RenderGraphResourceHandle CreateTexture(wstring_view name, const RenderGraphTextureDesc& desc);
+
+	/// <summary>
+	/// Create transient buffer that lives only in graph.
+	/// </summary>
+	RenderGraphResourceHandle CreateBuffer(wstring_view name, const RenderGraphBufferDesc& desc);
+
+	/// <summary>
+	/// Declare pass reads resource.
+	/// </summary>
+	/// <param name="handle"> The resource handle. </param>
+	/// <param name="state"> The state that pass requires. </param>
+	RenderGraphResourceHandle Read(RenderGraphResourceHandle handle, ERHIResourceStates state);
+
+	/// <summary>
+	/// Declare pass writes resource.
+	/// </summary>
+	/// <param name="handle"> The resource handle. </param>
+	/// <param name="state"> The state that pass requires. </param>
+	RenderGraphResourceHandle Write(RenderGraphResourceHandle handle, ERHIResourceStates state);
+
+	/// <summary>
+	/// Declare pass has side effects that is not visible to graph, so pass is never culled.
+	/// </summary>
+	void SetSideEffect();
+};
+
+/// <summary>
+/// Represents render graph that passes declare resources they read and write.
+/// Compilation culls passes whose outputs nobody reads, schedules minimal state transitions and aliases transient resources whose lifetimes don't overlap.
+/// Compilation does not touch device, so graph can be compiled on null device.
+/// </summary>
+export class RenderGraph : public RHIDeviceChild
+{
+	friend class RenderGraphBuilder;
+
+public:
+	using Super = RHIDeviceChild;
+	using SetupFunction = function<void(RenderGraphBuilder&)>;
+	using ExecuteFunction = function<void(RHIDeviceContext*, const RenderGraph&)>;
+
+	/// <summary>
+	/// The count of frames that unused physical resources are kept for reuse.
+	/// </summary>
+	static constexpr uint64 MaxUnusedFrames = 8;
+
+private:
+	struct ResourceAccess
+	{
+		RenderGraphResourceHandle Resource;
+		ERHIResourceStates State;
+		uint8 bWrite : 1;
+	};
+
+	struct Pass
+	{
+		wstring Name;
+		ExecuteFunction Execute;
+		vector<ResourceAccess> Accesses;
+		vector<RenderGraphBarrier> Barriers;
+		int32 RefCount = 0;
+		uint8 bSideEffect : 1 = false;
+		uint8 bCulled : 1 = false;
+	};
+
+	struct ResourceDesc
+	{
+		ERenderGraphResourceType Type = ERenderGraphResourceType::Texture;
+		RenderGraphTextureDesc Texture;
+		RenderGraphBufferDesc Buffer;
+		ERHIResourceFlags Flags = ERHIResourceFlags::None;
+
+		bool operator ==(const ResourceDesc&) const = default;
+	};
+
+	struct Resource
+	{
+		wstring Name;
+		ResourceDesc Desc;
+		RHIResource* Imported = nullptr;
+		ERHIResourceStates FinalState = ERHIResourceStates::Common;
+		vector<int32> Producers;
+		int32 RefCount = 0;
+		int32 FirstPass = -1;
+		int32 LastPass = -1;
+		int32 PhysicalIndex = -1;
+	};
+
+	struct PhysicalResource
+	{
+		ResourceDesc Desc;
+		int32 LastPass = -1;
+		RHIResource* Resource = nullptr;
+	};
+
+	struct PooledResource
+	{
+		ResourceDesc Desc;
+		RHIResource* Resource = nullptr;
+		uint64 LastUsedFrame = 0;
+		uint8 bInUse : 1 = false;
+	};
+
+	vector<Pass> _passes;
+	vector<Resource> _resources;
+	vector<PhysicalResource> _physicals;
+	vector<RenderGraphBarrier> _finalBarriers;
+	vector<PooledResource> _pool;
+	uint64 _frameNumber = 0;
+	uint8 _bCompiled : 1 = false;
+	RenderGraphStatistics _statistics;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="RenderGraph"/> instance.
+	/// </summary>
+	RenderGraph(RHIDevice* device);
+	~RenderGraph() override;
+
+	/// <summary>
+	/// Import external resource to graph. Passes that write imported resources are never culled.
+	/// </summary>
+	/// <param name="name"> The debug name of resource. </param>
+	/// <param name="resource"> The external resource. </param>
+	/// <param name="finalState"> The state that resource is transitioned to after all passes. </param>
+	RenderGraphResourceHandle ImportResource(wstring_view name, RHIResource* resource, ERHIResourceStates finalState);
+
+	/// <summary>
+	/// Add pass to graph. Setup function is invoked immediately, and execute function is invoked by Execute() if pass is not culled.
+	/// </summary>
+	/// <param name="name"> The debug name of pass. </param>
+	/// <param name="setup"> The function that declares resources and their usages. </param>
+	/// <param name="execute"> The function that records commands of pass. </param>
+	/// <returns> The index of pass. </returns>
+	int32 AddPass(wstring_view name, SetupFunction setup, ExecuteFunction execute);
+
+	/// <summary>
+	/// Cull unused passes, compute lifetimes, alias transient resources and schedule barriers.
+	/// </summary>
+	void Compile();
+
+	/// <summary>
+	/// Realize transient resources and record passes in order. Compile graph first if it is not compiled.
+	/// Barriers are queued to device context and flushed as batch before first command of each pass.
+	/// </summary>
+	/// <param name="deviceContext"> The device context that is begun. </param>
+	void Execute(RHIDeviceContext* deviceContext);
+
+	/// <summary>
+	/// Release physical resources that are not used for <see cref="MaxUnusedFrames"/> frames after GPU completes fence value.
+	/// </summary>
+	/// <param name="fenceValue"> The fence value of frame that executed graph. </param>
+	void RetireFrame(uint64 fenceValue);
+
+	/// <summary>
+	/// Remove all passes and resources. Physical resources are kept for reuse.
+	/// </summary>
+	void Reset();
+
+	/// <summary>
+	/// Get resource that handle refers. Transient resources are valid only while graph is executing.
+	/// </summary>
+	RHIResource* GetResource(RenderGraphResourceHandle handle) const;
+
+	/// <summary>
+	/// Indicate pass is culled by last compilation.
+	/// </summary>
+	bool IsPassCulled(int32 passIndex) const { return _passes[passIndex].bCulled; }
+
+	/// <summary>
+	/// Get barriers that recorded before pass.
+	/// </summary>
+	span<const RenderGraphBarrier> GetPassBarriers(int32 passIndex) const { return _passes[passIndex].Barriers; }
+
+	/// <summary>
+	/// Get barriers that transition imported resources to final states after all passes.
+	/// </summary>
+	span<const RenderGraphBarrier> GetFinalBarriers() const { return _finalBarriers; }
+
+	/// <summary>
+	/// Get index of physical resource that transient resource is aliased to. Return -1 if resource is imported or unused.
+	/// </summary>
+	int32 GetPhysicalIndex(RenderGraphResourceHandle handle) const { return _resources[handle.Index].PhysicalIndex; }
+
+	/// <summary>
+	/// Get result of last compilation.
+	/// </summary>
+	const RenderGraphStatistics& GetStatistics() const { return _statistics; }
+
+private:
+	RenderGraphResourceHandle CreateTransient(wstring_view name, const ResourceDesc& desc);
+	void AddAccess(int32 passIndex, RenderGraphResourceHandle handle, ERHIResourceStates state, bool bWrite);
+	void CullPasses();
+	void ComputeLifetimes();
+	void AliasResources();
+	void ScheduleBarriers();
+	RHIResource* AcquirePhysical(const ResourceDesc& desc);
+};
\ No newline at end of file
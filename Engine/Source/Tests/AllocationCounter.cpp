@@ -0,0 +1,59 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+#include <malloc.h>
+
+import std.core;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	// Counted per thread, so that allocations of worker threads do not disturb measured thread.
+	thread_local size_t GNumAllocations = 0;
+}
+
+size_t AllocationCounter::GetNumAllocations()
+{
+	return GNumAllocations;
+}
+
+void* operator new(size_t size)
+{
+	++GNumAllocations;
+	if (void* memory = malloc(size == 0 ? 1 : size); memory != nullptr)
+	{
+		return memory;
+	}
+	throw bad_alloc();
+}
+
+void* operator new(size_t size, align_val_t alignment)
+{
+	++GNumAllocations;
+	if (void* memory = _aligned_malloc(size == 0 ? 1 : size, (size_t)alignment); memory != nullptr)
+	{
+		return memory;
+	}
+	throw bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+	free(memory);
+}
+
+void operator delete(void* memory, align_val_t) noexcept
+{
+	_aligned_free(memory);
+}
+
+void operator delete(void* memory, size_t, align_val_t) noexcept
+{
+	_aligned_free(memory);
+}
\ No newline at end of file
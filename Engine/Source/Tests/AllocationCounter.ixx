@@ -0,0 +1,19 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Tests:AllocationCounter;
+
+import std.core;
+
+using namespace std;
+
+/// <summary>
+/// Counts global heap allocations. Test executable replaces global operator new to count them.
+/// </summary>
+export class AllocationCounter
+{
+public:
+	/// <summary>
+	/// Get count of allocations that calling thread made since it was started.
+	/// </summary>
+	static size_t GetNumAllocations();
+};
\ No newline at end of file
@@ -0,0 +1,153 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	filesystem::path GetTemporaryLogPath(wstring_view name)
+	{
+		filesystem::path path = filesystem::temp_directory_path() / format(L"SC.Tests.{}.log", name);
+		filesystem::remove(path);
+		return path;
+	}
+
+	vector<wstring> ReadLines(const filesystem::path& path)
+	{
+		vector<wstring> lines;
+		wifstream stream(path);
+		wstring line;
+		while (getline(stream, line))
+		{
+			lines.emplace_back(line);
+		}
+		return lines;
+	}
+
+	void DropWhenFull(TestContext& context)
+	{
+		filesystem::path path = GetTemporaryLogPath(L"DropWhenFull");
+		FileReference file(path);
+		{
+			// Writer thread does not wake up by itself while the test is pushing.
+			AsyncLogWriter writer(&file, 4, 1024, 10s);
+
+			size_t numAccepted = 0;
+			for (int32 i = 0; i < 6; ++i)
+			{
+				numAccepted += writer.Push(format(L"Message {}\n", i)) ? 1 : 0;
+			}
+
+			context.Check(numAccepted == 4, L"Push accepts messages up to capacity.");
+			context.Check(writer.GetNumDropped() == 2, L"Messages over capacity are dropped without blocking.");
+			context.Check(writer.GetQueueDepth() == 4, L"Queue depth is count of accepted messages.");
+
+			writer.Flush();
+			context.Check(writer.GetNumWritten() == 4, L"Flush writes all queued messages.");
+			context.Check(writer.GetQueueDepth() == 0, L"Queue is empty after flush.");
+			context.Check(writer.Push(L"After flush\n"), L"Freed cells accept new message.");
+		}
+
+		vector<wstring> lines = ReadLines(path);
+		context.Check(lines == vector<wstring>{ L"Message 0", L"Message 1", L"Message 2", L"Message 3", L"After flush" }, L"Messages are written in push order and remaining messages are written on destruction.");
+		filesystem::remove(path);
+	}
+
+	void ConcurrentProducers(TestContext& context)
+	{
+		constexpr int32 NumThreads = 4;
+		constexpr int32 NumMessages = 1000;
+
+		filesystem::path path = GetTemporaryLogPath(L"ConcurrentProducers");
+		FileReference file(path);
+		size_t numDropped = 0;
+		{
+			AsyncLogWriter writer(&file, NumThreads * NumMessages, 256, 10ms);
+
+			vector<thread> producers;
+			for (int32 t = 0; t < NumThreads; ++t)
+			{
+				producers.emplace_back([&writer, t]()
+				{
+					for (int32 i = 0; i < NumMessages; ++i)
+					{
+						writer.Push(format(L"{} {}\n", t, i));
+					}
+				});
+			}
+
+			for (auto& producer : producers)
+			{
+				producer.join();
+			}
+
+			numDropped = writer.GetNumDropped();
+		}
+
+		context.Check(numDropped == 0, L"No message is dropped when capacity is enough.");
+
+		// Each producer's messages should appear once and in its own order.
+		vector<int32> nextIndex(NumThreads, 0);
+		size_t numLines = 0;
+		bool bOrdered = true;
+		for (auto& line : ReadLines(path))
+		{
+			int32 t = -1;
+			int32 i = -1;
+			wistringstream(line) >> t >> i;
+			if (t < 0 || t >= NumThreads || nextIndex[t] != i)
+			{
+				bOrdered = false;
+				break;
+			}
+
+			++nextIndex[t];
+			++numLines;
+		}
+
+		context.Check(bOrdered, L"Messages of each producer are written in order.");
+		context.Check(numLines == NumThreads * NumMessages, L"All messages are written.");
+		filesystem::remove(path);
+	}
+
+	void PushLatency(TestContext& context)
+	{
+		constexpr size_t NumIterations = 100000;
+
+		filesystem::path path = GetTemporaryLogPath(L"PushLatency");
+		FileReference file(path);
+		{
+			AsyncLogWriter writer(&file, 1 << 16);
+			auto push = context.Measure(NumIterations, [&]()
+			{
+				writer.Push(L"The quick brown fox jumps over the lazy dog.\n");
+			});
+
+			context.Report(L"AsyncLogWriter::Push", push.count() * 1000.0, L"ns/message");
+			context.Report(L"Dropped", (double)writer.GetNumDropped(), L"messages");
+		}
+
+		{
+			wofstream stream(path, ios::app);
+			auto write = context.Measure(NumIterations / 10, [&]()
+			{
+				stream << L"The quick brown fox jumps over the lazy dog.\n";
+				stream.flush();
+			});
+
+			context.Report(L"Synchronous write", write.count() * 1000.0, L"ns/message");
+		}
+
+		filesystem::remove(path);
+	}
+
+	TestRegistration GDropWhenFull(L"AsyncLogWriter.DropWhenFull", ETestKind::Test, DropWhenFull);
+	TestRegistration GConcurrentProducers(L"AsyncLogWriter.ConcurrentProducers", ETestKind::Test, ConcurrentProducers);
+	TestRegistration GPushLatency(L"AsyncLogWriter.PushLatency", ETestKind::Benchmark, PushLatency);
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	static_assert(LogFormatString(L"Compile time {}").Id == BinaryLogWriter::GetHashCode(L"Compile time {}"), "Format identifier should be computed at compile time.");
+
+	constexpr uint64 TestCategoryId = BinaryLogWriter::GetHashCode(L"BinaryTest");
+
+	filesystem::path GetTemporaryLogPath(wstring_view name)
+	{
+		filesystem::path path = filesystem::temp_directory_path() / format(L"SC.Tests.{}.binlog", name);
+		filesystem::remove(path);
+		return path;
+	}
+
+	// Decode and strip timestamp, so each line is 'LogCategory: Verbosity: Message'.
+	vector<wstring> DecodeLines(const filesystem::path& path, bool& bDecoded)
+	{
+		wostringstream output;
+		bDecoded = BinaryLogDecoder::Decode(path, output);
+
+		vector<wstring> lines;
+		wistringstream input(output.str());
+		wstring line;
+		while (getline(input, line))
+		{
+			if (size_t pos = line.find(L": Log"); pos != wstring::npos)
+			{
+				lines.emplace_back(line.substr(pos + 2));
+			}
+		}
+		return lines;
+	}
+
+	void RoundTrip(TestContext& context)
+	{
+		filesystem::path path = GetTemporaryLogPath(L"RoundTrip");
+		{
+			BinaryLogWriter writer(path);
+			writer.Write(TestCategoryId, L"BinaryTest", Info, L"Signed {} unsigned {} double {:.2f}", -3, 7u, 1.5);
+			writer.Write(TestCategoryId, L"BinaryTest", Warning, L"Bool {} string {} char {}", true, L"text", L'c');
+			writer.Write(TestCategoryId, L"BinaryTest", Error, L"Indexed {1} {0} escaped {{}}", 1, 2);
+			writer.Write(TestCategoryId, L"BinaryTest", Info, L"Signed {} unsigned {} double {:.2f}", 4, 5u, 6.0);
+		}
+
+		bool bDecoded = false;
+		vector<wstring> lines = DecodeLines(path, bDecoded);
+
+		context.Check(bDecoded, L"Written file is decoded.");
+		context.Check(lines == vector<wstring>
+		{
+			L"LogBinaryTest: Info: Signed -3 unsigned 7 double 1.50",
+			L"LogBinaryTest: Warning: Bool true string text char c",
+			L"LogBinaryTest: Error: Indexed 2 1 escaped {}",
+			L"LogBinaryTest: Info: Signed 4 unsigned 5 double 6.00",
+		}, L"Decoded messages are same as formatted messages.");
+		filesystem::remove(path);
+	}
+
+	void MalformedPlaceholder(TestContext& context)
+	{
+		filesystem::path path = GetTemporaryLogPath(L"MalformedPlaceholder");
+		{
+			BinaryLogWriter writer(path);
+			writer.Write(TestCategoryId, L"BinaryTest", Info, L"Spec {0:Q} index {5} name {x} valid {0}", 42);
+		}
+
+		bool bDecoded = false;
+		vector<wstring> lines = DecodeLines(path, bDecoded);
+
+		context.Check(bDecoded, L"Malformed placeholder does not abort decoding.");
+		context.Check(lines.size() == 1 && lines[0] == L"LogBinaryTest: Info: Spec {0:Q} index {5} name {x} valid 42", L"Malformed placeholder is kept as written.");
+		filesystem::remove(path);
+	}
+
+	void TruncatedFile(TestContext& context)
+	{
+		filesystem::path path = GetTemporaryLogPath(L"TruncatedFile");
+		{
+			BinaryLogWriter writer(path);
+			writer.Write(TestCategoryId, L"BinaryTest", Info, L"Message {}", 1);
+		}
+
+		filesystem::resize_file(path, filesystem::file_size(path) - 3);
+
+		wostringstream output;
+		context.Check(!BinaryLogDecoder::Decode(path, output), L"Truncated record fails to decode.");
+		context.Check(!BinaryLogDecoder::Decode(GetTemporaryLogPath(L"NotExists"), output), L"Missing file fails to decode.");
+		filesystem::remove(path);
+	}
+
+	void CorruptedStringLength(TestContext& context)
+	{
+		filesystem::path path = GetTemporaryLogPath(L"CorruptedStringLength");
+		{
+			ofstream stream(path, ios::binary);
+			auto write = [&stream](const auto& value) { stream.write((const char*)&value, sizeof(value)); };
+
+			// Format record that claims string longer than file.
+			write(BinaryLogWriter::Magic);
+			write(BinaryLogWriter::Version);
+			write(EBinaryLogRecord::Format);
+			write(TestCategoryId);
+			write(numeric_limits<uint32>::max());
+			write(L'x');
+		}
+
+		bool bDecoded = true;
+		try
+		{
+			wostringstream output;
+			bDecoded = BinaryLogDecoder::Decode(path, output);
+		}
+		catch (const bad_alloc&)
+		{
+		}
+
+		context.Check(!bDecoded, L"String that is longer than remaining bytes fails to decode without allocating.");
+		filesystem::remove(path);
+	}
+
+	void ConcurrentWriters(TestContext& context)
+	{
+		constexpr int32 NumThreads = 4;
+		constexpr int32 NumMessages = 2000;
+
+		filesystem::path path = GetTemporaryLogPath(L"ConcurrentWriters");
+		{
+			// Small buffer makes threads flush their buffers while others are writing.
+			BinaryLogWriter writer(path, 1024);
+
+			vector<thread> threads;
+			for (int32 t = 0; t < NumThreads; ++t)
+			{
+				threads.emplace_back([&writer, t]()
+				{
+					for (int32 i = 0; i < NumMessages; ++i)
+					{
+						writer.Write(TestCategoryId, L"BinaryTest", Info, L"Thread {} message {}", t, i);
+					}
+				});
+			}
+
+			for (auto& writerThread : threads)
+			{
+				writerThread.join();
+			}
+		}
+
+		bool bDecoded = false;
+		vector<wstring> lines = DecodeLines(path, bDecoded);
+
+		context.Check(bDecoded, L"Buffers flushed by multiple threads are decoded.");
+		context.Check(lines.size() == NumThreads * NumMessages, L"All messages are decoded.");
+		filesystem::remove(path);
+	}
+
+	void WriteCost(TestContext& context)
+	{
+		constexpr size_t NumIterations = 1000000;
+
+		filesystem::path path = GetTemporaryLogPath(L"WriteCost");
+		{
+			BinaryLogWriter writer(path);
+			int32 value = 0;
+			auto binary = context.Measure(NumIterations, [&]()
+			{
+				writer.Write(TestCategoryId, L"BinaryTest", Info, L"Frame {} elapsed {:.3f} name {}", value++, 0.016, L"Actor");
+			});
+
+			wstring message;
+			auto text = context.Measure(NumIterations, [&]()
+			{
+				message = format(L"Frame {} elapsed {:.3f} name {}", value++, 0.016, L"Actor");
+			});
+
+			context.Report(L"BinaryLogWriter::Write", binary.count() * 1000.0, L"ns/message");
+			context.Report(L"std::format", text.count() * 1000.0, L"ns/message");
+		}
+		filesystem::remove(path);
+	}
+
+	TestRegistration GRoundTrip(L"BinaryLog.RoundTrip", ETestKind::Test, RoundTrip);
+	TestRegistration GMalformedPlaceholder(L"BinaryLog.MalformedPlaceholder", ETestKind::Test, MalformedPlaceholder);
+	TestRegistration GTruncatedFile(L"BinaryLog.TruncatedFile", ETestKind::Test, TruncatedFile);
+	TestRegistration GCorruptedStringLength(L"BinaryLog.CorruptedStringLength", ETestKind::Test, CorruptedStringLength);
+	TestRegistration GConcurrentWriters(L"BinaryLog.ConcurrentWriters", ETestKind::Test, ConcurrentWriters);
+	TestRegistration GWriteCost(L"BinaryLog.WriteCost", ETestKind::Benchmark, WriteCost);
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	// Null device has not pipeline, so shaders are distinguished by instance.
+	class TestShader : public RHIShader
+	{
+	public:
+		using Super = RHIShader;
+
+		TestShader(RHIDevice* device) : Super(device)
+		{
+		}
+
+	protected:
+		span<uint8 const> CompileVS() override { return {}; }
+		span<uint8 const> CompilePS() override { return {}; }
+	};
+
+	// Count of recorded and elided commands.
+	using CommandCounts = pair<uint64, uint64>;
+	constexpr CommandCounts Recorded = { 1, 0 };
+	constexpr CommandCounts Elided = { 0, 1 };
+
+	template<class TBody>
+	CommandCounts CountCommands(RHIDeviceContext* deviceContext, TBody&& body)
+	{
+		const RHIDeviceStatistics before = deviceContext->GetStatistics();
+		body();
+		const RHIDeviceStatistics& after = deviceContext->GetStatistics();
+		return { after.NumCommands - before.NumCommands, after.NumElidedCommands - before.NumElidedCommands };
+	}
+
+	void PrimitiveTopology(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		auto setTopology = [deviceContext](ERHIPrimitiveTopology topology) { return CountCommands(deviceContext, [&]() { deviceContext->IASetPrimitiveTopology(topology); }); };
+
+		deviceContext->Begin();
+		context.Check(setTopology(ERHIPrimitiveTopology::TriangleList) == Recorded, L"First topology is recorded.");
+		context.Check(setTopology(ERHIPrimitiveTopology::TriangleList) == Elided, L"Same topology is elided.");
+		context.Check(setTopology(ERHIPrimitiveTopology::TriangleStrip) == Recorded, L"Changed topology is recorded.");
+
+		deviceContext->InvalidateStates();
+		context.Check(setTopology(ERHIPrimitiveTopology::TriangleStrip) == Recorded, L"Topology is recorded after states are invalidated.");
+		deviceContext->End();
+
+		deviceContext->Begin();
+		context.Check(setTopology(ERHIPrimitiveTopology::TriangleStrip) == Recorded, L"Begin resets shadow state.");
+		deviceContext->End();
+	}
+
+	void GraphicsShader(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		TestShader* first = device.CreateSubobject<TestShader>(&device);
+		TestShader* second = device.CreateSubobject<TestShader>(&device);
+		auto setShader = [deviceContext](RHIShader* shader) { return CountCommands(deviceContext, [&]() { deviceContext->SetGraphicsShader(shader); }); };
+
+		deviceContext->Begin();
+		context.Check(setShader(first) == Recorded, L"First shader is recorded.");
+		context.Check(setShader(first) == Elided, L"Same shader is elided.");
+		context.Check(setShader(second) == Recorded, L"Changed shader is recorded.");
+		context.Check(setShader(first) == Recorded, L"Shader that set before previous one is recorded.");
+
+		deviceContext->InvalidateStates();
+		context.Check(setShader(first) == Recorded, L"Shader is recorded after states are invalidated.");
+		deviceContext->End();
+
+		deviceContext->Begin();
+		context.Check(setShader(first) == Recorded, L"Begin resets shadow state.");
+		deviceContext->End();
+	}
+
+	void RenderTargets(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		RHIRenderTargetView* rtv = device.CreateSubobject<RHIRenderTargetView>(&device, 2);
+		RHIRenderTargetView* otherRtv = device.CreateSubobject<RHIRenderTargetView>(&device, 2);
+		for (int32 i = 0; i < 2; ++i)
+		{
+			rtv->CreateRenderTargetView(device.CreateTexture2D(64, 64, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, ERHIResourceStates::RenderTarget), i);
+			otherRtv->CreateRenderTargetView(device.CreateTexture2D(64, 64, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, ERHIResourceStates::RenderTarget), i);
+		}
+
+		auto setRenderTargets = [deviceContext](RHIRenderTargetView* view, int32 index, int32 count)
+		{
+			return CountCommands(deviceContext, [&]() { deviceContext->OMSetRenderTargets(view, index, count); });
+		};
+
+		deviceContext->Begin();
+		context.Check(setRenderTargets(rtv, 0, 2) == Recorded, L"First render targets are recorded.");
+		context.Check(setRenderTargets(rtv, 0, 2) == Elided, L"Same render targets are elided.");
+		context.Check(CountCommands(deviceContext, [&]() { deviceContext->OMSetRenderTargets(rtv); }) == Elided, L"Whole view is same with index 0 and descriptor count.");
+		context.Check(setRenderTargets(rtv, 1, 1) == Recorded, L"Changed index is recorded.");
+		context.Check(setRenderTargets(rtv, 1, 1) == Elided, L"Same index and count are elided.");
+		context.Check(setRenderTargets(rtv, 0, 1) == Recorded, L"Changed index with same count is recorded.");
+		context.Check(setRenderTargets(rtv, 0, 2) == Recorded, L"Changed count is recorded.");
+		context.Check(setRenderTargets(otherRtv, 0, 2) == Recorded, L"Changed view is recorded.");
+
+		deviceContext->InvalidateStates();
+		context.Check(setRenderTargets(otherRtv, 0, 2) == Recorded, L"Render targets are recorded after states are invalidated.");
+		deviceContext->End();
+
+		deviceContext->Begin();
+		context.Check(setRenderTargets(otherRtv, 0, 2) == Recorded, L"Begin resets shadow state.");
+		deviceContext->End();
+	}
+
+	void ViewportsAndScissorRects(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+
+		RHIViewport viewports[2] = { { .Width = 64, .Height = 64, .MaxDepth = 1 }, { .Width = 32, .Height = 32, .MaxDepth = 1 } };
+		RHIScissorRect rects[2] = { { .Right = 64, .Bottom = 64 }, { .Right = 32, .Bottom = 32 } };
+		auto setViewports = [&](int32 count) { return CountCommands(deviceContext, [&]() { deviceContext->RSSetViewports(count, viewports); }); };
+		auto setScissorRects = [&](int32 count) { return CountCommands(deviceContext, [&]() { deviceContext->RSSetScissorRects(count, rects); }); };
+
+		deviceContext->Begin();
+		context.Check(setViewports(1) == Recorded && setScissorRects(1) == Recorded, L"First viewports and scissor rects are recorded.");
+		context.Check(setViewports(1) == Elided && setScissorRects(1) == Elided, L"Same viewports and scissor rects are elided.");
+		context.Check(setViewports(2) == Recorded && setScissorRects(2) == Recorded, L"Changed count is recorded.");
+
+		viewports[1].Width = 16;
+		rects[1].Right = 16;
+		context.Check(setViewports(2) == Recorded && setScissorRects(2) == Recorded, L"Changed values are recorded.");
+
+		deviceContext->InvalidateStates();
+		context.Check(setViewports(2) == Recorded && setScissorRects(2) == Recorded, L"Viewports and scissor rects are recorded after states are invalidated.");
+		deviceContext->End();
+
+		deviceContext->Begin();
+		context.Check(setViewports(2) == Recorded && setScissorRects(2) == Recorded, L"Begin resets shadow state.");
+		deviceContext->End();
+	}
+
+	void VertexBuffers(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+
+		RHIVertexBufferView views[3] =
+		{
+			{ .BufferLocation = 0x1000, .SizeInBytes = 256, .StrideInBytes = 16 },
+			{ .BufferLocation = 0x2000, .SizeInBytes = 256, .StrideInBytes = 16 },
+			{ .BufferLocation = 0x3000, .SizeInBytes = 256, .StrideInBytes = 16 },
+		};
+		auto setVertexBuffers = [deviceContext](uint32 startSlot, uint32 numViews, const RHIVertexBufferView* vertexBuffers)
+		{
+			return CountCommands(deviceContext, [&]() { deviceContext->IASetVertexBuffers(startSlot, numViews, vertexBuffers); });
+		};
+
+		deviceContext->Begin();
+		context.Check(setVertexBuffers(0, 3, views) == Recorded, L"First vertex buffers are recorded.");
+		context.Check(setVertexBuffers(0, 3, views) == Elided, L"Same vertex buffers are elided.");
+		context.Check(setVertexBuffers(1, 2, views + 1) == Elided, L"Sub-range of same vertex buffers is elided.");
+
+		views[1].BufferLocation = 0x4000;
+		context.Check(setVertexBuffers(0, 3, views) == Recorded, L"Changed slot is recorded.");
+		context.Check(setVertexBuffers(0, 3, views) == Elided, L"Changed range is shadowed.");
+
+		context.Check(setVertexBuffers(1, 1, nullptr) == Recorded, L"Null view unbinds slot.");
+		context.Check(setVertexBuffers(1, 1, nullptr) == Elided, L"Unbound slot is shadowed.");
+
+		context.Check(setVertexBuffers(4, 1, views) == Recorded, L"Slot that is not bound before is recorded.");
+		context.Check(setVertexBuffers(RHIDeviceContext::MaxVertexBufferSlots - 1, 2, views) == Recorded, L"Range out of shadowed slots is recorded as is.");
+		context.Check(setVertexBuffers(RHIDeviceContext::MaxVertexBufferSlots - 1, 2, views) == Recorded, L"Range out of shadowed slots is never elided.");
+
+		deviceContext->InvalidateStates();
+		context.Check(setVertexBuffers(0, 3, views) == Recorded, L"Vertex buffers are recorded after states are invalidated.");
+		deviceContext->End();
+
+		deviceContext->Begin();
+		context.Check(setVertexBuffers(0, 3, views) == Recorded, L"Begin resets shadow state.");
+		deviceContext->End();
+	}
+
+	TestRegistration GPrimitiveTopology(L"DeviceContextState.PrimitiveTopology", ETestKind::Test, PrimitiveTopology);
+	TestRegistration GGraphicsShader(L"DeviceContextState.GraphicsShader", ETestKind::Test, GraphicsShader);
+	TestRegistration GRenderTargets(L"DeviceContextState.RenderTargets", ETestKind::Test, RenderTargets);
+	TestRegistration GViewportsAndScissorRects(L"DeviceContextState.ViewportsAndScissorRects", ETestKind::Test, ViewportsAndScissorRects);
+	TestRegistration GVertexBuffers(L"DeviceContextState.VertexBuffers", ETestKind::Test, VertexBuffers);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	// Engine is not initialized, so simulation is stepped headless without device and render thread.
+	void VariableTimeStep(TestContext& context)
+	{
+		GameEngine engine(false, ERHIDeviceType::Null);
+
+		context.Check(engine.StepSimulation(16ms) == 1, L"Variable time step ticks once per frame.");
+		context.Check(engine.GetInterpolationAlpha() == 1.0f, L"Variable time step does not interpolate.");
+	}
+
+	void FixedTimeStep(TestContext& context)
+	{
+		// Durations are exact in binary floating point, so accumulated time is compared exactly.
+		GameEngine engine(false, ERHIDeviceType::Null);
+		engine.SetFixedTimeStep(250ms);
+		engine.SetMaxSubsteps(4);
+
+		context.Check(engine.StepSimulation(125ms) == 0, L"Frame shorter than time step does not tick.");
+		context.Check(engine.GetInterpolationAlpha() == 0.5f, L"Alpha is remaining time over time step.");
+
+		context.Check(engine.StepSimulation(125ms) == 1, L"Accumulated time ticks.");
+		context.Check(engine.GetInterpolationAlpha() == 0.0f, L"Alpha is zero without remaining time.");
+
+		context.Check(engine.StepSimulation(625ms) == 2, L"Long frame ticks multiple substeps.");
+		context.Check(engine.GetInterpolationAlpha() == 0.5f, L"Remaining time is kept.");
+
+		// 1.625s accumulated. Four substeps consume 1s, and 0.5s of remaining 0.625s is dropped.
+		context.Check(engine.StepSimulation(1500ms) == 4, L"Substeps are limited by maximum substeps.");
+		context.Check(engine.GetInterpolationAlpha() == 0.5f, L"Time that exceeds maximum substeps is dropped except fraction of time step.");
+
+		context.Check(engine.StepSimulation(0ms) == 0, L"Dropped time is not simulated on next frame.");
+		context.Check(engine.GetInterpolationAlpha() == 0.5f, L"Alpha is kept without elapsed time.");
+
+		engine.SetFixedTimeStep(nullopt);
+		context.Check(engine.StepSimulation(1500ms) == 1 && engine.GetInterpolationAlpha() == 1.0f, L"Fixed time step can be disabled.");
+	}
+
+	void InterpolationAlphaRange(TestContext& context)
+	{
+		GameEngine engine(false, ERHIDeviceType::Null);
+		engine.SetFixedTimeStep(duration<float>(1.0f / 60.0f));
+		engine.SetMaxSubsteps(3);
+
+		bool bAlphaInRange = true;
+		bool bStepsInRange = true;
+		int32 numSteps = 0;
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			// Frame times from 0ms to 90ms, include frames longer than maximum substeps.
+			int32 steps = engine.StepSimulation(milliseconds(i * 7 % 91));
+			float alpha = engine.GetInterpolationAlpha();
+			bAlphaInRange = bAlphaInRange && alpha >= 0.0f && alpha < 1.0f;
+			bStepsInRange = bStepsInRange && steps >= 0 && steps <= 3;
+			numSteps += steps;
+		}
+
+		context.Check(bAlphaInRange, L"Alpha is in [0, 1) for fixed time step.");
+		context.Check(bStepsInRange, L"Count of substeps is in [0, maximum substeps].");
+		context.Check(numSteps > 0, L"Simulation is advanced.");
+	}
+
+	TestRegistration GVariableTimeStep(L"GameEngine.VariableTimeStep", ETestKind::Test, VariableTimeStep);
+	TestRegistration GFixedTimeStep(L"GameEngine.FixedTimeStep", ETestKind::Test, FixedTimeStep);
+	TestRegistration GInterpolationAlphaRange(L"GameEngine.InterpolationAlphaRange", ETestKind::Test, InterpolationAlphaRange);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	class TestActor : public AActor
+	{
+	public:
+		using Super = AActor;
+	};
+
+	void StaleHandle(TestContext& context)
+	{
+		HandleTable<int32> table;
+		ObjectHandle first = table.Add(1);
+		ObjectHandle second = table.Add(2);
+
+		context.Check(first.IsSet() && second.IsSet(), L"Added handle is set.");
+		context.Check(!table.IsValid(ObjectHandle()), L"Default handle is never valid.");
+		context.Check(table.Remove(first), L"Remove valid handle.");
+		context.Check(!table.Remove(first), L"Remove stale handle fails.");
+		context.Check(table.Find(first) == nullptr, L"Stale handle does not resolve.");
+
+		ObjectHandle reused = table.Add(3);
+		context.Check(reused.Index == first.Index && reused.Generation != first.Generation, L"Freed slot is reused with new generation.");
+		context.Check(table.Find(first) == nullptr, L"Stale handle does not resolve to item in reused slot.");
+		context.Check(table.Find(reused) != nullptr && *table.Find(reused) == 3, L"Reused handle resolves to new item.");
+	}
+
+	void DenseItems(TestContext& context)
+	{
+		HandleTable<int32> table;
+		vector<ObjectHandle> handles;
+		for (int32 i = 0; i < 8; ++i)
+		{
+			handles.emplace_back(table.Add(i));
+		}
+
+		table.Remove(handles[0]);
+		table.Remove(handles[3]);
+
+		context.Check(table.GetCount() == 6, L"Count is decreased by removal.");
+		context.Check(table.GetItems().size() == 6, L"Items are kept dense.");
+		for (int32 i = 0; i < 8; ++i)
+		{
+			if (i == 0 || i == 3)
+			{
+				continue;
+			}
+
+			const int32* item = table.Find(handles[i]);
+			context.Check(item != nullptr && *item == i, format(L"Handle {} still resolves after swap-remove.", i));
+		}
+
+		table.Clear();
+		context.Check(table.GetCount() == 0, L"Clear removes all items.");
+		context.Check(!table.IsValid(handles[7]), L"Handle is invalid after clear.");
+	}
+
+	void WorldActorHandle(TestContext& context)
+	{
+		World world;
+		auto* actor = world.SpawnActor<TestActor>();
+		ObjectHandle handle = actor->GetHandle();
+
+		context.Check(world.ResolveActor(handle) == actor, L"Spawned actor resolves from handle.");
+		context.Check(world.ResolveActor<TestActor>(handle) == actor, L"Typed resolve succeeds with actor class.");
+
+		world.DestroyActor(actor);
+		context.Check(world.ResolveActor(handle) == nullptr, L"Destroyed actor is invalid immediately, before pending kill flush.");
+
+		auto* respawned = world.SpawnActor<TestActor>();
+		context.Check(world.ResolveActor(handle) == nullptr, L"Stale handle does not resolve to respawned actor.");
+		context.Check(world.ResolveActor(respawned->GetHandle()) == respawned, L"Respawned actor resolves from its own handle.");
+
+		PendingKillQueue::Flush();
+	}
+
+	TestRegistration GStaleHandle(L"HandleTable.StaleHandle", ETestKind::Test, StaleHandle);
+	TestRegistration GDenseItems(L"HandleTable.DenseItems", ETestKind::Test, DenseItems);
+	TestRegistration GWorldActorHandle(L"HandleTable.WorldActorHandle", ETestKind::Test, WorldActorHandle);
+}
\ No newline at end of file
@@ -0,0 +1,232 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	constexpr size_t NumTestWorkers = 3;
+
+	void ScheduleAndWait(TestContext& context)
+	{
+		constexpr size_t NumJobs = 10000;
+
+		JobSystem::Initialize(NumTestWorkers);
+		context.Check(JobSystem::GetNumWorkers() == NumTestWorkers, L"Requested count of workers are started.");
+
+		atomic<size_t> numExecuted = 0;
+		JobCounter counter;
+		for (size_t i = 0; i < NumJobs; ++i)
+		{
+			JobSystem::Schedule([&numExecuted]() { numExecuted.fetch_add(1, memory_order_relaxed); }, &counter);
+		}
+
+		counter.Wait();
+		context.Check(counter.IsCompleted(), L"Counter is zero after wait.");
+		context.Check(numExecuted.load() == NumJobs, L"All jobs are executed before wait returns.");
+
+		JobSystem::Shutdown();
+	}
+
+	void Prerequisite(TestContext& context)
+	{
+		constexpr size_t NumJobs = 64;
+
+		JobSystem::Initialize(NumTestWorkers);
+
+		atomic<size_t> numFirst = 0;
+		atomic<size_t> numViolations = 0;
+		JobCounter first;
+		JobCounter second;
+
+		// Hold first counter, so every second job is deferred as continuation.
+		first.Increment();
+		for (size_t i = 0; i < NumJobs; ++i)
+		{
+			JobSystem::Schedule([&]()
+			{
+				if (numFirst.load() != NumJobs)
+				{
+					numViolations.fetch_add(1);
+				}
+			}, &second, &first);
+		}
+
+		for (size_t i = 0; i < NumJobs; ++i)
+		{
+			JobSystem::Schedule([&numFirst]() { numFirst.fetch_add(1); }, &first);
+		}
+
+		first.Decrement();
+		second.Wait();
+
+		context.Check(numViolations.load() == 0, L"Job runs after prerequisite is completed.");
+		context.Check(second.IsCompleted() && first.IsCompleted(), L"Both counters are completed.");
+
+		JobSystem::Shutdown();
+	}
+
+	void NestedWait(TestContext& context)
+	{
+		constexpr size_t NumOuter = 16;
+		constexpr size_t NumInner = 64;
+
+		// Single worker should not deadlock when job waits nested jobs.
+		JobSystem::Initialize(1);
+
+		atomic<size_t> numInner = 0;
+		JobCounter outer;
+		for (size_t i = 0; i < NumOuter; ++i)
+		{
+			JobSystem::Schedule([&numInner]()
+			{
+				JobCounter inner;
+				for (size_t j = 0; j < NumInner; ++j)
+				{
+					JobSystem::Schedule([&numInner]() { numInner.fetch_add(1); }, &inner);
+				}
+				inner.Wait();
+			}, &outer);
+		}
+
+		outer.Wait();
+		context.Check(numInner.load() == NumOuter * NumInner, L"Nested jobs are completed.");
+
+		JobSystem::Shutdown();
+	}
+
+	void ParallelForRange(TestContext& context)
+	{
+		constexpr size_t Count = 100003;
+
+		JobSystem::Initialize(NumTestWorkers);
+
+		vector<atomic<uint8>> visited(Count);
+		JobSystem::ParallelFor(Count, [&visited](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				visited[i].fetch_add(1, memory_order_relaxed);
+			}
+		}, 64);
+
+		JobSystem::Shutdown();
+
+		bool bExactlyOnce = all_of(visited.begin(), visited.end(), [](const atomic<uint8>& value) { return value.load() == 1; });
+		context.Check(bExactlyOnce, L"Each index is processed exactly once.");
+
+		size_t numCalls = 0;
+		JobSystem::ParallelFor(10, [&numCalls](size_t begin, size_t end) { numCalls += end - begin; });
+		context.Check(numCalls == 10, L"ParallelFor without worker runs on calling thread.");
+	}
+
+	void ThrowingJob(TestContext& context)
+	{
+		JobSystem::Initialize(NumTestWorkers);
+
+		atomic<size_t> numExecuted = 0;
+		JobCounter counter;
+		for (size_t i = 0; i < 16; ++i)
+		{
+			JobSystem::Schedule([&numExecuted, i]()
+			{
+				numExecuted.fetch_add(1);
+				if (i % 2 == 0)
+				{
+					throw runtime_error("Job failed.");
+				}
+			}, &counter);
+		}
+
+		counter.Wait();
+		context.Check(counter.IsCompleted() && numExecuted.load() == 16, L"Counter of throwing job is completed.");
+
+		JobSystem::Shutdown();
+	}
+
+	void Scaling(TestContext& context)
+	{
+		constexpr size_t NumJobs = 20000;
+		constexpr size_t FineCount = 1 << 22;
+		constexpr size_t CoarseCount = 1024;
+		constexpr int32 CoarseWork = 16384;
+
+		const size_t maxThreads = max(thread::hardware_concurrency(), 1u);
+		vector<float> values(FineCount, 1.0f);
+		double fineBaseline = 0;
+		double coarseBaseline = 0;
+
+		for (size_t numThreads = 1; numThreads <= maxThreads; ++numThreads)
+		{
+			if (numThreads > 1)
+			{
+				JobSystem::Initialize(numThreads - 1);
+			}
+
+			// Small jobs measure scheduling overhead.
+			auto jobs = context.Measure(5, [&]()
+			{
+				JobCounter counter;
+				for (size_t i = 0; i < NumJobs; ++i)
+				{
+					JobSystem::Schedule([]() {}, &counter);
+				}
+				counter.Wait();
+			});
+
+			// Fine-grained loop with tiny work per item and small chunks measures scheduling overhead of ParallelFor.
+			auto fine = context.Measure(5, [&]()
+			{
+				JobSystem::ParallelFor(FineCount, [&values](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						values[i] = values[i] * 1.0001f + 0.5f;
+					}
+				}, 256);
+			});
+
+			// Coarse-grained loop with heavy work per item measures load balance.
+			auto coarse = context.Measure(5, [&]()
+			{
+				JobSystem::ParallelFor(CoarseCount, [&values](size_t begin, size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						float state = values[i];
+						for (int32 work = 0; work < CoarseWork; ++work)
+						{
+							state = sqrt(state * 1.0001f + 0.5f);
+						}
+						values[i] = state;
+					}
+				});
+			});
+
+			if (numThreads == 1)
+			{
+				fineBaseline = fine.count();
+				coarseBaseline = coarse.count();
+			}
+
+			context.Report(format(L"{} threads, Schedule", numThreads), jobs.count() * 1000.0 / NumJobs, L"ns/job");
+			context.Report(format(L"{} threads, fine-grained ParallelFor", numThreads), fine.count() / 1000.0, L"ms");
+			context.Report(format(L"{} threads, fine-grained ParallelFor speedup", numThreads), fineBaseline / fine.count(), L"x");
+			context.Report(format(L"{} threads, coarse-grained ParallelFor", numThreads), coarse.count() / 1000.0, L"ms");
+			context.Report(format(L"{} threads, coarse-grained ParallelFor speedup", numThreads), coarseBaseline / coarse.count(), L"x");
+
+			JobSystem::Shutdown();
+		}
+	}
+
+	TestRegistration GScheduleAndWait(L"JobSystem.ScheduleAndWait", ETestKind::Test, ScheduleAndWait);
+	TestRegistration GPrerequisite(L"JobSystem.Prerequisite", ETestKind::Test, Prerequisite);
+	TestRegistration GNestedWait(L"JobSystem.NestedWait", ETestKind::Test, NestedWait);
+	TestRegistration GParallelForRange(L"JobSystem.ParallelForRange", ETestKind::Test, ParallelForRange);
+	TestRegistration GThrowingJob(L"JobSystem.ThrowingJob", ETestKind::Test, ThrowingJob);
+	TestRegistration GScaling(L"JobSystem.Scaling", ETestKind::Benchmark, Scaling);
+}
\ No newline at end of file
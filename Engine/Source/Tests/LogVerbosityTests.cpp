@@ -0,0 +1,128 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+using enum ELogVerbosity;
+
+namespace
+{
+	// Counts how many times the argument is formatted.
+	struct CountedArgument
+	{
+		int32* NumFormatted;
+	};
+}
+
+template<>
+struct std::formatter<CountedArgument, wchar_t> : std::formatter<int32, wchar_t>
+{
+	auto format(const CountedArgument& argument, auto& context)
+	{
+		return std::formatter<int32, wchar_t>::format(++*argument.NumFormatted, context);
+	}
+};
+
+namespace
+{
+	class CaptureLogCategory : public LogCategory
+	{
+	public:
+		using Super = LogCategory;
+
+		vector<pair<ELogVerbosity, wstring>> Messages;
+
+		CaptureLogCategory() : LogCategory(L"Capture")
+		{
+		}
+
+	protected:
+		void OnLog(ELogVerbosity logVerbosity, wstring_view message) override
+		{
+			Messages.emplace_back(logVerbosity, wstring(message));
+		}
+	};
+
+	void FilterByCategory(TestContext& context)
+	{
+		CaptureLogCategory category;
+		category.SetVerbosity(Warning);
+
+		int32 numFormatted = 0;
+		LogSystem::Log<Verbose>(category, L"Verbose {}", CountedArgument{ &numFormatted });
+		LogSystem::Log<Info>(category, L"Info {}", CountedArgument{ &numFormatted });
+		LogSystem::Log<Warning>(category, L"Warning {}", CountedArgument{ &numFormatted });
+		LogSystem::Log<Error>(category, L"Error {}", CountedArgument{ &numFormatted });
+
+		context.Check(category.Messages.size() == 2, L"Logs more verbose than category verbosity are filtered.");
+		context.Check(numFormatted == 2, L"Filtered logs are not formatted.");
+		context.Check(category.Messages.size() == 2 && category.Messages[0].first == Warning && category.Messages[0].second == L"Warning 1", L"Warning is delivered with formatted message.");
+		context.Check(category.Messages.size() == 2 && category.Messages[1].first == Error, L"Error is delivered.");
+	}
+
+	void FilterByRuntimeVerbosity(TestContext& context)
+	{
+		CaptureLogCategory category;
+		category.SetVerbosity(Info);
+
+		int32 numFormatted = 0;
+		for (ELogVerbosity verbosity : { Verbose, Info, Warning })
+		{
+			LogSystem::Log(category, verbosity, L"{}", CountedArgument{ &numFormatted });
+		}
+
+		context.Check(category.Messages.size() == 2 && numFormatted == 2, L"Runtime verbosity is filtered before formatting.");
+		context.Check(!category.IsEnabled(Verbose) && category.IsEnabled(Info) && category.IsEnabled(Fatal), L"IsEnabled compares with category verbosity.");
+	}
+
+	void FatalThrows(TestContext& context)
+	{
+		CaptureLogCategory category;
+		category.SetVerbosity(Fatal);
+
+		bool bThrown = false;
+		try
+		{
+			LogSystem::Log<Fatal>(category, L"Fatal");
+		}
+		catch (const exception&)
+		{
+			bThrown = true;
+		}
+
+		context.Check(bThrown, L"Fatal log throws.");
+		context.Check(category.Messages.size() == 1, L"Fatal log is never filtered.");
+	}
+
+	void FilteredLogCost(TestContext& context)
+	{
+		constexpr size_t NumIterations = 1000000;
+
+		CaptureLogCategory category;
+		category.SetVerbosity(Warning);
+
+		int32 value = 0;
+		auto compiled = context.Measure(NumIterations, [&]()
+		{
+			LogSystem::Log<Verbose>(category, L"Filtered {} {}", value++, L"message");
+		});
+
+		ELogVerbosity runtimeVerbosity = Verbose;
+		auto runtime = context.Measure(NumIterations, [&]()
+		{
+			LogSystem::Log(category, runtimeVerbosity, L"Filtered {} {}", value++, L"message");
+		});
+
+		context.Check(category.Messages.empty(), L"Filtered logs are not delivered.");
+		context.Report(L"Log<Verbose> filtered", compiled.count() * 1000.0, L"ns/call");
+		context.Report(L"Log(Verbose) filtered", runtime.count() * 1000.0, L"ns/call");
+	}
+
+	TestRegistration GFilterByCategory(L"LogVerbosity.FilterByCategory", ETestKind::Test, FilterByCategory);
+	TestRegistration GFilterByRuntimeVerbosity(L"LogVerbosity.FilterByRuntimeVerbosity", ETestKind::Test, FilterByRuntimeVerbosity);
+	TestRegistration GFatalThrows(L"LogVerbosity.FatalThrows", ETestKind::Test, FatalThrows);
+	TestRegistration GFilteredLogCost(L"LogVerbosity.FilteredLogCost", ETestKind::Benchmark, FilteredLogCost);
+}
\ No newline at end of file
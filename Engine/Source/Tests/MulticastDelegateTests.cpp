@@ -0,0 +1,150 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	struct Receiver
+	{
+		int32 Sum = 0;
+
+		void OnValue(int32 value)
+		{
+			Sum += value;
+		}
+	};
+
+	void InvokeBindings(TestContext& context)
+	{
+		MulticastDelegate<void(int32)> delegate;
+		Receiver receiver;
+		vector<int32> calls;
+
+		delegate.AddRaw([&calls](int32 value) { calls.emplace_back(value); });
+		delegate.AddMember(&receiver, &Receiver::OnValue);
+
+		// Larger than inline storage, so stored on heap.
+		array<int64, 16> large = {};
+		large[15] = 100;
+		delegate += [&calls, large](int32 value) { calls.emplace_back(value + (int32)large[15]); };
+
+		delegate.Invoke(5);
+		context.Check(delegate.GetCount() == 3, L"All bindings are counted.");
+		context.Check(calls == vector<int32>{ 5, 105 }, L"Bindings are invoked in bound order.");
+		context.Check(receiver.Sum == 5, L"Member function is invoked.");
+	}
+
+	void RemoveWhileInvoking(TestContext& context)
+	{
+		MulticastDelegate<void()> delegate;
+		int32 numSelf = 0;
+		int32 numLater = 0;
+		int64 selfId = -1;
+		int64 laterId = -1;
+
+		selfId = delegate.AddRaw([&]()
+		{
+			++numSelf;
+			delegate.RemoveRaw(selfId);
+			delegate.RemoveRaw(laterId);
+		});
+		laterId = delegate.AddRaw([&]() { ++numLater; });
+
+		delegate.Invoke();
+		context.Check(numSelf == 1, L"Binding can remove itself while invoking.");
+		context.Check(numLater == 0, L"Binding removed while invoking is not called.");
+		context.Check(delegate.GetCount() == 0, L"Removed bindings are compacted after invoke.");
+
+		delegate.Invoke();
+		context.Check(numSelf == 1, L"Removed binding is not called on next invoke.");
+	}
+
+	void AddWhileInvoking(TestContext& context)
+	{
+		MulticastDelegate<void()> delegate;
+		int32 numAdded = 0;
+		bool bAdded = false;
+
+		delegate.AddRaw([&]()
+		{
+			if (!bAdded)
+			{
+				bAdded = true;
+				delegate.AddRaw([&]() { ++numAdded; });
+
+				// Nested invoke does not see pending binding either.
+				delegate.Invoke();
+			}
+		});
+
+		delegate.Invoke();
+		context.Check(numAdded == 0, L"Binding added while invoking is pending.");
+		context.Check(delegate.GetCount() == 2, L"Pending binding is counted.");
+
+		delegate.Invoke();
+		context.Check(numAdded == 1, L"Pending binding is called from next invoke.");
+	}
+
+	void InvokeWithoutAllocation(TestContext& context)
+	{
+		MulticastDelegate<void(int32)> delegate;
+		Receiver receiver;
+		int64 sum = 0;
+
+		delegate.AddRaw([&sum](int32 value) { sum += value; });
+		delegate.AddMember(&receiver, &Receiver::OnValue);
+
+		// Heap stored binding allocates when bound, not when invoked.
+		array<int64, 16> large = {};
+		delegate.AddRaw([&sum, large](int32 value) { sum += value + large[0]; });
+
+		const size_t numAllocations = AllocationCounter::GetNumAllocations();
+		for (int32 i = 0; i < 100; ++i)
+		{
+			delegate.Invoke(1);
+		}
+
+		context.Check(AllocationCounter::GetNumAllocations() == numAllocations, L"Invoke does not allocate.");
+		context.Check(sum == 200 && receiver.Sum == 100, L"All bindings are invoked.");
+	}
+
+	void InvokeThroughput(TestContext& context)
+	{
+		constexpr size_t NumIterations = 100000;
+
+		for (size_t numBindings : { 1, 8, 64 })
+		{
+			MulticastDelegate<void(int32)> delegate;
+			vector<function<void(int32)>> functions;
+			int64 sum = 0;
+			for (size_t i = 0; i < numBindings; ++i)
+			{
+				delegate.AddRaw([&sum](int32 value) { sum += value; });
+				functions.emplace_back([&sum](int32 value) { sum += value; });
+			}
+
+			auto multicast = context.Measure(NumIterations, [&]() { delegate.Invoke(1); });
+			auto stdFunction = context.Measure(NumIterations, [&]()
+			{
+				for (auto& func : functions)
+				{
+					func(1);
+				}
+			});
+
+			context.Check(sum == (int64)(numBindings * (NumIterations + 1) * 2), L"All bindings are invoked.");
+			context.Report(format(L"MulticastDelegate::Invoke, {} bindings", numBindings), multicast.count() * 1000.0 / numBindings, L"ns/binding");
+			context.Report(format(L"vector<function>, {} bindings", numBindings), stdFunction.count() * 1000.0 / numBindings, L"ns/binding");
+		}
+	}
+
+	TestRegistration GInvokeBindings(L"MulticastDelegate.InvokeBindings", ETestKind::Test, InvokeBindings);
+	TestRegistration GRemoveWhileInvoking(L"MulticastDelegate.RemoveWhileInvoking", ETestKind::Test, RemoveWhileInvoking);
+	TestRegistration GAddWhileInvoking(L"MulticastDelegate.AddWhileInvoking", ETestKind::Test, AddWhileInvoking);
+	TestRegistration GInvokeWithoutAllocation(L"MulticastDelegate.InvokeWithoutAllocation", ETestKind::Test, InvokeWithoutAllocation);
+	TestRegistration GInvokeThroughput(L"MulticastDelegate.InvokeThroughput", ETestKind::Benchmark, InvokeThroughput);
+}
\ No newline at end of file
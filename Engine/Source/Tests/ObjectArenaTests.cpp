@@ -0,0 +1,166 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	size_t GNumDestroyed = 0;
+
+	class TestObject : public Object
+	{
+	public:
+		using Super = Object;
+
+		uint8 Payload[48] = {};
+
+		TestObject() = default;
+
+		~TestObject() override
+		{
+			++GNumDestroyed;
+		}
+	};
+
+	class LargeTestObject : public Object
+	{
+	public:
+		using Super = Object;
+
+		uint8 Payload[ObjectArena::MaxAllocationSize] = {};
+	};
+
+	void AllocateFromArena(TestContext& context)
+	{
+		TestObject outer;
+		outer.EnableSubobjectArena();
+		ObjectArena* arena = outer.GetSubobjectArena();
+
+		auto* first = outer.CreateSubobject<TestObject>();
+		auto* second = outer.CreateSubobject<TestObject>();
+
+		context.Check(arena->GetNumAllocations() == 2, L"Two subobjects are allocated from arena.");
+		context.Check(arena->GetUsedBytes() == 2 * ObjectArena::GetAllocationSize(sizeof(TestObject)), L"Used bytes are rounded up to size class.");
+		context.Check(arena->GetNumBlocks() == 1, L"Small subobjects share one block.");
+		context.Check(first->GetSubobjectArena() == arena && second->GetSubobjectArena() == arena, L"Subobject carved from arena shares arena of outer.");
+		context.Check(reinterpret_cast<uintptr_t>(first) % ObjectArena::Alignment == 0, L"Arena allocation is aligned.");
+	}
+
+	void ReuseFreedSlot(TestContext& context)
+	{
+		TestObject outer;
+		outer.EnableSubobjectArena();
+		ObjectArena* arena = outer.GetSubobjectArena();
+
+		auto* first = outer.CreateSubobject<TestObject>();
+		outer.CreateSubobject<TestObject>();
+		void* firstMemory = first;
+
+		GNumDestroyed = 0;
+		Object::DestroySubobject(first);
+		context.Check(GNumDestroyed == 1, L"Destroyed subobject runs destructor.");
+		context.Check(arena->GetNumAllocations() == 1, L"Destroyed subobject returns memory to arena.");
+
+		auto* reused = outer.CreateSubobject<TestObject>();
+		context.Check(static_cast<void*>(reused) == firstMemory, L"Freed slot is reused by same size class.");
+		context.Check(arena->GetNumBlocks() == 1, L"Reused slot does not reserve new block.");
+	}
+
+	void NestedSubobjects(TestContext& context)
+	{
+		GNumDestroyed = 0;
+		{
+			TestObject outer;
+			outer.EnableSubobjectArena();
+			ObjectArena* arena = outer.GetSubobjectArena();
+
+			auto* child = outer.CreateSubobject<TestObject>();
+			child->CreateSubobject<TestObject>();
+			child->CreateSubobject<TestObject>();
+
+			context.Check(arena->GetNumAllocations() == 3, L"Subobjects of subobject are allocated from same arena.");
+		}
+
+		context.Check(GNumDestroyed == 4, L"Outer destroys all nested subobjects.");
+	}
+
+	void LargeObjectFallback(TestContext& context)
+	{
+		TestObject outer;
+		outer.EnableSubobjectArena();
+		ObjectArena* arena = outer.GetSubobjectArena();
+
+		auto* large = outer.CreateSubobject<LargeTestObject>();
+		context.Check(arena->GetNumAllocations() == 0, L"Object larger than MaxAllocationSize is allocated from global heap.");
+		context.Check(large->GetSubobjectArena() == nullptr, L"Heap object does not inherit arena.");
+		context.Check(large->GetOuter() == &outer, L"Heap object is still linked to outer.");
+	}
+
+	void PendingKillFlush(TestContext& context)
+	{
+		TestObject outer;
+		outer.EnableSubobjectArena();
+		ObjectArena* arena = outer.GetSubobjectArena();
+
+		auto* victim = outer.CreateSubobject<TestObject>();
+		auto* cancelled = outer.CreateSubobject<TestObject>();
+		victim->MarkPendingKill();
+		cancelled->MarkPendingKill();
+		context.Check(victim->IsPendingKill(), L"Marked object is pending kill.");
+
+		// Destroyed before flush; the queue entry should be cancelled.
+		GNumDestroyed = 0;
+		Object::DestroySubobject(cancelled);
+
+		PendingKillQueue::Flush();
+		context.Check(GNumDestroyed == 2, L"Flush destroys pending kill object exactly once.");
+		context.Check(arena->GetNumAllocations() == 0, L"Pending kill object returns memory to arena.");
+		context.Check(PendingKillQueue::GetNumPending() == 0, L"Queue is empty after flush.");
+	}
+
+	void SpawnAndDestroyActors(TestContext& context)
+	{
+		constexpr size_t NumActors = 100000;
+
+		for (auto [bUseSubobjectArena, pathName] : { pair(false, L"heap"), pair(true, L"arena") })
+		{
+			World world(bUseSubobjectArena);
+			vector<AActor*> actors(NumActors);
+
+			// Spawn and destroy twice, so that second pass of arena path reuses freed slots.
+			for (int32 pass = 0; pass < 2; ++pass)
+			{
+				const size_t numAllocations = AllocationCounter::GetNumAllocations();
+				auto start = steady_clock::now();
+
+				for (auto& actor : actors)
+				{
+					actor = world.SpawnActor<AActor>();
+				}
+
+				for (auto& actor : actors)
+				{
+					world.DestroyActor(actor);
+				}
+
+				PendingKillQueue::Flush();
+
+				duration<double, milli> elapsed = steady_clock::now() - start;
+				context.Report(format(L"{}, pass {}, wall time", pathName, pass), elapsed.count(), L"ms");
+				context.Report(format(L"{}, pass {}, allocations", pathName, pass), (double)(AllocationCounter::GetNumAllocations() - numAllocations), L"allocations");
+			}
+		}
+	}
+
+	TestRegistration GAllocateFromArena(L"ObjectArena.AllocateFromArena", ETestKind::Test, AllocateFromArena);
+	TestRegistration GReuseFreedSlot(L"ObjectArena.ReuseFreedSlot", ETestKind::Test, ReuseFreedSlot);
+	TestRegistration GNestedSubobjects(L"ObjectArena.NestedSubobjects", ETestKind::Test, NestedSubobjects);
+	TestRegistration GLargeObjectFallback(L"ObjectArena.LargeObjectFallback", ETestKind::Test, LargeObjectFallback);
+	TestRegistration GPendingKillFlush(L"ObjectArena.PendingKillFlush", ETestKind::Test, PendingKillFlush);
+	TestRegistration GSpawnAndDestroyActors(L"ObjectArena.SpawnAndDestroyActors", ETestKind::Benchmark, SpawnAndDestroyActors);
+}
\ No newline at end of file
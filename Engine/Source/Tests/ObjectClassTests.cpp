@@ -0,0 +1,98 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	class Level0 : public Object
+	{
+	public:
+		using Super = Object;
+
+		Level0() = default;
+		~Level0() override = default;
+	};
+
+	class Level1 : public Level0 { public: using Super = Level0; };
+	class Level2 : public Level1 { public: using Super = Level1; };
+	class Level3 : public Level2 { public: using Super = Level2; };
+	class Level4 : public Level3 { public: using Super = Level3; };
+	class Level5 : public Level4 { public: using Super = Level4; };
+	class Sibling : public Level0 { public: using Super = Level0; };
+
+	void ClassHierarchy(TestContext& context)
+	{
+		Level0 outer;
+		auto* deep = outer.CreateSubobject<Level5>();
+		auto* sibling = outer.CreateSubobject<Sibling>();
+
+		context.Check(deep->GetClass() == ObjectClass::StaticClass<Level5>(), L"Object class is assigned by CreateSubobject.");
+		context.Check(deep->IsA<Object>() && deep->IsA<Level0>() && deep->IsA<Level3>() && deep->IsA<Level5>(), L"Deep class is child of all ancestors.");
+		context.Check(!deep->IsA<Sibling>(), L"Deep class is not child of sibling branch.");
+		context.Check(!sibling->IsA<Level1>(), L"Sibling is not child of other branch.");
+		context.Check(!outer.CreateSubobject<Level1>()->IsA<Level5>(), L"Base class is not child of derived class.");
+		context.Check(ObjectClass::StaticClass<Level5>()->GetSuper() == ObjectClass::StaticClass<Level4>(), L"Super class is resolved by T::Super.");
+	}
+
+	void CompareWithRTTI(TestContext& context)
+	{
+		constexpr size_t NumObjects = 1024;
+		constexpr size_t NumIterations = 1000;
+
+		Level0 outer;
+		outer.EnableSubobjectArena();
+
+		vector<Object*> objects;
+		objects.reserve(NumObjects);
+		for (size_t i = 0; i < NumObjects; ++i)
+		{
+			switch (i % 3)
+			{
+			case 0:
+				objects.emplace_back(outer.CreateSubobject<Level5>());
+				break;
+			case 1:
+				objects.emplace_back(outer.CreateSubobject<Level2>());
+				break;
+			default:
+				objects.emplace_back(outer.CreateSubobject<Sibling>());
+				break;
+			}
+		}
+
+		// Sink prevents the loops from being optimized out.
+		volatile size_t sink = 0;
+
+		auto objectClass = context.Measure(NumIterations, [&]()
+		{
+			size_t count = 0;
+			for (auto& object : objects)
+			{
+				count += object->IsA<Level2>() ? 1 : 0;
+			}
+			sink = count;
+		});
+		const size_t objectClassCount = sink;
+
+		auto rtti = context.Measure(NumIterations, [&]()
+		{
+			size_t count = 0;
+			for (auto& object : objects)
+			{
+				count += dynamic_cast<const Level2*>(object) != nullptr ? 1 : 0;
+			}
+			sink = count;
+		});
+
+		context.Check(objectClassCount == sink, L"ObjectClass and RTTI agree.");
+		context.Report(L"ObjectClass::IsChildOf", objectClass.count() * 1000.0 / NumObjects, L"ns/check");
+		context.Report(L"dynamic_cast", rtti.count() * 1000.0 / NumObjects, L"ns/check");
+	}
+
+	TestRegistration GClassHierarchy(L"ObjectClass.ClassHierarchy", ETestKind::Test, ClassHierarchy);
+	TestRegistration GCompareWithRTTI(L"ObjectClass.CompareWithRTTI", ETestKind::Benchmark, CompareWithRTTI);
+}
\ No newline at end of file
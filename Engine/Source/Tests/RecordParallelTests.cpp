@@ -0,0 +1,114 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	// Draws that use shared texture. The last range leaves texture in CopySource, other ranges in PixelShaderResource,
+	// so final global state shows whether local states are resolved in submission order.
+	void RecordDraws(RHIDeviceContext* deviceContext, RHITexture2D* texture, size_t begin, size_t end, size_t count)
+	{
+		deviceContext->IASetPrimitiveTopology(ERHIPrimitiveTopology::TriangleList);
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (i % 64 == 0)
+			{
+				deviceContext->TransitionState(texture, i % 128 == 0 ? ERHIResourceStates::RenderTarget : ERHIResourceStates::PixelShaderResource);
+			}
+			deviceContext->DrawInstanced(3);
+		}
+
+		deviceContext->TransitionState(texture, end == count ? ERHIResourceStates::CopySource : ERHIResourceStates::PixelShaderResource);
+	}
+
+	void SharedResourceStates(TestContext& context)
+	{
+		constexpr size_t NumDraws = 10000;
+
+		JobSystem::Initialize(3);
+		{
+			RHIDevice device(false, ERHIDeviceType::Null);
+			RHIDeviceContextPool* pool = device.CreateSubobject<RHIDeviceContextPool>(&device, 1);
+			RHITexture2D* texture = device.CreateTexture2D(256, 256, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, ERHIResourceStates::Common);
+
+			// Each frame starts from CopySource that previous frame ends with, so initial transitions differ from frame to frame.
+			bool bFinalState = true;
+			bool bDrawCount = true;
+			size_t numContexts = 0;
+			for (int32 frame = 0; frame < 8; ++frame)
+			{
+				device.ResetStatistics();
+				span<RHIDeviceContext*> contexts = pool->RecordParallel(0, NumDraws, [texture](RHIDeviceContext* deviceContext, size_t begin, size_t end)
+				{
+					RecordDraws(deviceContext, texture, begin, end, NumDraws);
+				}, 256);
+
+				device.GetPrimaryQueue()->ExecuteDeviceContexts(contexts);
+				device.GetPrimaryQueue()->WaitLastSignal();
+
+				bFinalState = bFinalState && texture->GetState() == ERHIResourceStates::CopySource;
+				bDrawCount = bDrawCount && device.GetStatistics().NumDrawCalls == NumDraws;
+				numContexts = contexts.size();
+			}
+
+			context.Check(numContexts > 1, L"Draws are recorded on multiple contexts.");
+			context.Check(bFinalState, L"Global state is state of last submitted context.");
+			context.Check(bDrawCount, L"All draws are recorded.");
+		}
+		JobSystem::Shutdown();
+	}
+
+	void FiftyThousandDraws(TestContext& context)
+	{
+		constexpr size_t NumDraws = 50000;
+		constexpr size_t NumFrames = 20;
+
+		const size_t maxThreads = max(thread::hardware_concurrency(), 1u);
+		double baseline = 0;
+
+		for (size_t numThreads = 1; numThreads <= maxThreads; ++numThreads)
+		{
+			if (numThreads > 1)
+			{
+				JobSystem::Initialize(numThreads - 1);
+			}
+
+			{
+				RHIDevice device(false, ERHIDeviceType::Null);
+				RHIDeviceContextPool* pool = device.CreateSubobject<RHIDeviceContextPool>(&device, 1);
+				RHITexture2D* texture = device.CreateTexture2D(256, 256, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, ERHIResourceStates::Common);
+
+				auto record = context.Measure(NumFrames, [&]()
+				{
+					span<RHIDeviceContext*> contexts = pool->RecordParallel(0, NumDraws, [texture](RHIDeviceContext* deviceContext, size_t begin, size_t end)
+					{
+						RecordDraws(deviceContext, texture, begin, end, NumDraws);
+					});
+
+					device.GetPrimaryQueue()->ExecuteDeviceContexts(contexts);
+					device.GetPrimaryQueue()->WaitLastSignal();
+				});
+
+				if (numThreads == 1)
+				{
+					baseline = record.count();
+				}
+
+				context.Check(device.GetStatistics().NumDrawCalls == NumDraws * (NumFrames + 1), format(L"All draws are recorded with {} threads.", numThreads));
+				context.Report(format(L"{} threads, record and submit", numThreads), record.count() / 1000.0, L"ms/frame");
+				context.Report(format(L"{} threads, speedup", numThreads), baseline / record.count(), L"x");
+			}
+
+			JobSystem::Shutdown();
+		}
+	}
+
+	TestRegistration GSharedResourceStates(L"RecordParallel.SharedResourceStates", ETestKind::Test, SharedResourceStates);
+	TestRegistration GFiftyThousandDraws(L"RecordParallel.FiftyThousandDraws", ETestKind::Benchmark, FiftyThousandDraws);
+}
\ No newline at end of file
@@ -0,0 +1,209 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	using enum ERHIResourceStates;
+
+	constexpr RenderGraphTextureDesc TestTextureDesc = { .Width = 64, .Height = 64, .Format = ERHIPixelFormat::R8G8B8A8_UNORM };
+
+	auto NoExecute = [](RHIDeviceContext*, const RenderGraph&) {};
+
+	void CullUnusedPasses(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RenderGraph* graph = device.CreateSubobject<RenderGraph>(&device);
+		RHITexture2D* backBuffer = device.CreateTexture2D(64, 64, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, Present);
+		RenderGraphResourceHandle output = graph->ImportResource(L"BackBuffer", backBuffer, Present);
+
+		RenderGraphResourceHandle unused;
+		RenderGraphResourceHandle chainFirst;
+		RenderGraphResourceHandle chainSecond;
+		RenderGraphResourceHandle scene;
+
+		int32 unusedPass = graph->AddPass(L"Unused", [&](RenderGraphBuilder& builder)
+		{
+			unused = builder.Write(builder.CreateTexture(L"Unused", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+
+		// Chain whose last output is never read is culled entirely.
+		int32 chainFirstPass = graph->AddPass(L"ChainFirst", [&](RenderGraphBuilder& builder)
+		{
+			chainFirst = builder.Write(builder.CreateTexture(L"ChainFirst", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+		int32 chainSecondPass = graph->AddPass(L"ChainSecond", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(chainFirst, PixelShaderResource);
+			chainSecond = builder.Write(builder.CreateTexture(L"ChainSecond", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+
+		int32 scenePass = graph->AddPass(L"Scene", [&](RenderGraphBuilder& builder)
+		{
+			scene = builder.Write(builder.CreateTexture(L"Scene", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+		int32 compositePass = graph->AddPass(L"Composite", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(scene, PixelShaderResource);
+			builder.Write(output, RenderTarget);
+		}, NoExecute);
+		int32 sideEffectPass = graph->AddPass(L"SideEffect", [&](RenderGraphBuilder& builder)
+		{
+			builder.SetSideEffect();
+		}, NoExecute);
+
+		graph->Compile();
+
+		context.Check(graph->IsPassCulled(unusedPass), L"Pass whose output is not read is culled.");
+		context.Check(graph->IsPassCulled(chainFirstPass) && graph->IsPassCulled(chainSecondPass), L"Culling propagates to producers of culled pass.");
+		context.Check(!graph->IsPassCulled(scenePass) && !graph->IsPassCulled(compositePass), L"Passes that contribute to imported resource are kept.");
+		context.Check(!graph->IsPassCulled(sideEffectPass), L"Pass with side effect is kept.");
+		context.Check(graph->GetStatistics().NumCulledPasses == 3, L"Culled passes are counted.");
+		context.Check(graph->GetPhysicalIndex(unused) == -1 && graph->GetPhysicalIndex(chainSecond) == -1, L"Resources of culled passes are not realized.");
+
+		// Execute functions of culled passes are not invoked.
+		vector<wstring> executed;
+		graph->Reset();
+		output = graph->ImportResource(L"BackBuffer", backBuffer, Present);
+		graph->AddPass(L"Unused", [&](RenderGraphBuilder& builder)
+		{
+			builder.Write(builder.CreateTexture(L"Unused", TestTextureDesc), RenderTarget);
+		}, [&](RHIDeviceContext*, const RenderGraph&) { executed.emplace_back(L"Unused"); });
+		graph->AddPass(L"Composite", [&](RenderGraphBuilder& builder)
+		{
+			builder.Write(output, RenderTarget);
+		}, [&](RHIDeviceContext*, const RenderGraph&) { executed.emplace_back(L"Composite"); });
+
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		deviceContext->Begin();
+		graph->Execute(deviceContext);
+		deviceContext->End();
+
+		context.Check(executed == vector<wstring>{ L"Composite" }, L"Only passes that are not culled are executed.");
+	}
+
+	void AliasTransientResources(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RenderGraph* graph = device.CreateSubobject<RenderGraph>(&device);
+		RHITexture2D* backBuffer = device.CreateTexture2D(64, 64, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, Present);
+		RenderGraphResourceHandle output = graph->ImportResource(L"BackBuffer", backBuffer, Present);
+
+		// Lifetimes: A = [0, 1], B = [1, 2], C = [2, 3].
+		RenderGraphResourceHandle a;
+		RenderGraphResourceHandle b;
+		RenderGraphResourceHandle c;
+		graph->AddPass(L"WriteA", [&](RenderGraphBuilder& builder)
+		{
+			a = builder.Write(builder.CreateTexture(L"A", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+		graph->AddPass(L"ReadAWriteB", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(a, PixelShaderResource);
+			b = builder.Write(builder.CreateTexture(L"B", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+		graph->AddPass(L"ReadBWriteC", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(b, PixelShaderResource);
+			c = builder.Write(builder.CreateTexture(L"C", TestTextureDesc), RenderTarget);
+		}, NoExecute);
+		graph->AddPass(L"ReadC", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(c, PixelShaderResource);
+			builder.Write(output, RenderTarget);
+		}, NoExecute);
+
+		graph->Compile();
+		const RenderGraphStatistics& statistics = graph->GetStatistics();
+
+		context.Check(graph->GetPhysicalIndex(a) == graph->GetPhysicalIndex(c), L"Resource is aliased if last pass of previous user precedes its first pass.");
+		context.Check(graph->GetPhysicalIndex(a) != graph->GetPhysicalIndex(b), L"Resources that are used by same pass are not aliased.");
+		context.Check(graph->GetPhysicalIndex(output) == -1, L"Imported resource is not aliased.");
+		context.Check(statistics.NumTransientResources == 3 && statistics.NumPhysicalResources == 2, L"Three transient resources use two physical resources.");
+		context.Check(statistics.AliasedBytes < statistics.TransientBytes, L"Aliasing reduces memory.");
+
+		// Physical resources are pooled and reused by next frame.
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		vector<RHIResource*> frameResources[2];
+		for (auto& resources : frameResources)
+		{
+			graph->Reset();
+			output = graph->ImportResource(L"BackBuffer", backBuffer, Present);
+			graph->AddPass(L"WriteA", [&](RenderGraphBuilder& builder)
+			{
+				a = builder.Write(builder.CreateTexture(L"A", TestTextureDesc), RenderTarget);
+			}, [&](RHIDeviceContext*, const RenderGraph& executingGraph) { resources.emplace_back(executingGraph.GetResource(a)); });
+			graph->AddPass(L"ReadA", [&](RenderGraphBuilder& builder)
+			{
+				builder.Read(a, PixelShaderResource);
+				builder.Write(output, RenderTarget);
+			}, NoExecute);
+
+			deviceContext->Begin();
+			graph->Execute(deviceContext);
+			deviceContext->End();
+		}
+
+		context.Check(frameResources[0].size() == 1 && frameResources[0][0] != nullptr, L"Transient resource is realized while executing.");
+		context.Check(frameResources[0] == frameResources[1], L"Physical resource is reused by next frame.");
+	}
+
+	void MergeReadStates(TestContext& context)
+	{
+		RHIDevice device(false, ERHIDeviceType::Null);
+		RenderGraph* graph = device.CreateSubobject<RenderGraph>(&device);
+		RHITexture2D* texture = device.CreateTexture2D(64, 64, ERHIPixelFormat::R8G8B8A8_UNORM, ERHIResourceFlags::AllowRenderTarget, RenderTarget);
+		RenderGraphResourceHandle shared = graph->ImportResource(L"Shared", texture, RenderTarget);
+
+		int32 pixelPass = graph->AddPass(L"PixelRead", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(shared, PixelShaderResource);
+			builder.SetSideEffect();
+		}, NoExecute);
+		int32 computePass = graph->AddPass(L"ComputeRead", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(shared, NonPixelShaderResource);
+			builder.SetSideEffect();
+		}, NoExecute);
+		int32 repeatedPass = graph->AddPass(L"RepeatedRead", [&](RenderGraphBuilder& builder)
+		{
+			builder.Read(shared, PixelShaderResource);
+			builder.SetSideEffect();
+		}, NoExecute);
+		int32 copyPass = graph->AddPass(L"CopyRead", [&](RenderGraphBuilder& builder)
+		{
+			// Multiple accesses in same pass require combined state.
+			builder.Read(shared, CopySource);
+			builder.Read(shared, PixelShaderResource);
+			builder.SetSideEffect();
+		}, NoExecute);
+
+		graph->Compile();
+
+		span<const RenderGraphBarrier> pixelBarriers = graph->GetPassBarriers(pixelPass);
+		context.Check(pixelBarriers.size() == 1 && pixelBarriers[0].StateBefore == RenderTarget, L"First read transitions from imported state.");
+		context.Check(pixelBarriers.size() == 1 && pixelBarriers[0].StateAfter == (PixelShaderResource | NonPixelShaderResource | CopySource), L"Consecutive reads are merged to first read barrier.");
+		context.Check(graph->GetPassBarriers(computePass).empty() && graph->GetPassBarriers(repeatedPass).empty() && graph->GetPassBarriers(copyPass).empty(), L"Merged reads do not record barriers.");
+
+		span<const RenderGraphBarrier> finalBarriers = graph->GetFinalBarriers();
+		context.Check(finalBarriers.size() == 1 && finalBarriers[0].StateAfter == RenderTarget, L"Imported resource is transitioned to final state.");
+		context.Check(graph->GetStatistics().NumBarriers == 2, L"Graph records two barriers.");
+
+		RHIDeviceContext* deviceContext = device.CreateSubobject<RHIDeviceContext>(&device);
+		deviceContext->Begin();
+		graph->Execute(deviceContext);
+		deviceContext->End();
+		device.GetPrimaryQueue()->ExecuteDeviceContext(deviceContext);
+
+		context.Check(texture->GetState() == RenderTarget, L"Imported resource is in final state after submission.");
+	}
+
+	TestRegistration GCullUnusedPasses(L"RenderGraph.CullUnusedPasses", ETestKind::Test, CullUnusedPasses);
+	TestRegistration GAliasTransientResources(L"RenderGraph.AliasTransientResources", ETestKind::Test, AliasTransientResources);
+	TestRegistration GMergeReadStates(L"RenderGraph.MergeReadStates", ETestKind::Test, MergeReadStates);
+}
\ No newline at end of file
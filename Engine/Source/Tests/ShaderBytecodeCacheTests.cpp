@@ -0,0 +1,174 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import std.filesystem;
+import SC.Runtime.Core;
+import SC.Runtime.RenderCore;
+import SC.Tests;
+
+using namespace std;
+
+namespace
+{
+	enum class EStubCompileResult
+	{
+		Succeeded,
+		Failed,
+		Throw,
+	};
+
+	// Compiler that returns source text as bytecode, so tests do not depend on D3DCompiler.
+	class StubShaderCompiler : virtual public Object, virtual public IRHIShaderCompiler
+	{
+	public:
+		using Super = Object;
+
+		string Identity = "Stub;Version=1";
+		EStubCompileResult Result = EStubCompileResult::Succeeded;
+		atomic<int32> NumCompiles = 0;
+
+		bool Compile(const RHIShaderSource& source, vector<uint8>& outBytecode, string& outMessage) override
+		{
+			++NumCompiles;
+			switch (Result)
+			{
+			case EStubCompileResult::Failed:
+				outMessage = "Stub compile error.";
+				return false;
+			case EStubCompileResult::Throw:
+				throw runtime_error("Stub compiler is crashed.");
+			default:
+				outBytecode.assign(source.Source.begin(), source.Source.end());
+				return true;
+			}
+		}
+
+		string GetIdentity() const override
+		{
+			return Identity;
+		}
+	};
+
+	RHIShaderSource MakeSource(string_view text)
+	{
+		return RHIShaderSource
+		{
+			.Name = L"StubShader",
+			.Source = string(text),
+			.EntryPoint = "Main",
+			.Target = "vs_5_1"
+		};
+	}
+
+	vector<uint8> AsBytes(string_view text)
+	{
+		return vector<uint8>(text.begin(), text.end());
+	}
+
+	filesystem::path GetTemporaryCacheDirectory(wstring_view name)
+	{
+		filesystem::path path = filesystem::temp_directory_path() / format(L"SC.Tests.{}", name);
+		filesystem::remove_all(path);
+		return path;
+	}
+
+	void CompileAndMemoryHit(TestContext& context)
+	{
+		JobSystem::Initialize(2);
+		{
+			StubShaderCompiler compiler;
+			RHIShaderBytecodeCache cache(&compiler, L"");
+
+			auto first = cache.Register(MakeSource("float4 Main() : SV_Position { return 0; }"));
+			auto duplicated = cache.Register(MakeSource("float4 Main() : SV_Position { return 0; }"));
+			auto second = cache.Register(MakeSource("float4 Main() : SV_Position { return 1; }"));
+			cache.CompileAll();
+
+			context.Check(first.get() == AsBytes("float4 Main() : SV_Position { return 0; }"), L"Future is satisfied with compiled bytecode.");
+			context.Check(duplicated.get() == first.get(), L"Same source shares future.");
+			context.Check(second.get() == AsBytes("float4 Main() : SV_Position { return 1; }"), L"Different source is compiled separately.");
+
+			RHIShaderBytecodeCacheStatistics statistics = cache.GetStatistics();
+			context.Check(statistics.NumCompiled == 2 && statistics.NumMemoryHits == 1 && compiler.NumCompiles == 2, L"Same source is compiled once.");
+		}
+		JobSystem::Shutdown();
+	}
+
+	void DiskHit(TestContext& context)
+	{
+		filesystem::path directory = GetTemporaryCacheDirectory(L"DiskHit");
+		StubShaderCompiler compiler;
+		{
+			RHIShaderBytecodeCache cache(&compiler, directory);
+			cache.Register(MakeSource("Shader"));
+			cache.CompileAll();
+		}
+
+		{
+			RHIShaderBytecodeCache cache(&compiler, directory);
+			auto bytecode = cache.Register(MakeSource("Shader"));
+			cache.CompileAll();
+
+			context.Check(bytecode.get() == AsBytes("Shader"), L"Bytecode is loaded from disk.");
+			context.Check(cache.GetStatistics().NumDiskHits == 1 && compiler.NumCompiles == 1, L"Persisted bytecode is not compiled again.");
+		}
+
+		compiler.Identity = "Stub;Version=2";
+		{
+			RHIShaderBytecodeCache cache(&compiler, directory);
+			cache.Register(MakeSource("Shader"));
+			cache.CompileAll();
+			cache.WaitAll();
+
+			context.Check(cache.GetStatistics().NumDiskHits == 0 && compiler.NumCompiles == 2, L"Bytecode of other compiler identity is not reused.");
+		}
+
+		filesystem::remove_all(directory);
+	}
+
+	void CompileFailure(TestContext& context)
+	{
+		filesystem::path directory = GetTemporaryCacheDirectory(L"CompileFailure");
+		JobSystem::Initialize(2);
+		{
+			StubShaderCompiler compiler;
+			RHIShaderBytecodeCache cache(&compiler, directory);
+
+			compiler.Result = EStubCompileResult::Failed;
+			auto failed = cache.Register(MakeSource("Failed"));
+			cache.CompileAll();
+			context.Check(failed.get().empty(), L"Failed compile satisfies future with empty bytecode.");
+
+			compiler.Result = EStubCompileResult::Throw;
+			auto thrown = cache.Register(MakeSource("Thrown"));
+			cache.CompileAll();
+
+			// Waiting would block forever if promise is abandoned by exception.
+			context.Check(thrown.wait_for(10s) == future_status::ready && thrown.get().empty(), L"Exception of compiler satisfies future with empty bytecode.");
+			context.Check(cache.GetStatistics().NumFailed == 2, L"Failures are counted.");
+		}
+		JobSystem::Shutdown();
+
+		bool bEmpty = filesystem::is_empty(directory);
+		context.Check(bEmpty, L"Failed bytecode is not persisted.");
+		filesystem::remove_all(directory);
+	}
+
+	void SourceHash(TestContext& context)
+	{
+		RHIShaderSource lhs = MakeSource("Shader");
+		RHIShaderSource rhs = MakeSource("Shader");
+		lhs.Defines = { { "AB", "C" } };
+		rhs.Defines = { { "A", "BC" } };
+
+		context.Check(RHIShaderBytecodeCache::ComputeHash(lhs, "Stub") != RHIShaderBytecodeCache::ComputeHash(rhs, "Stub"), L"Boundary of strings is hashed.");
+		context.Check(RHIShaderBytecodeCache::ComputeHash(lhs, "Stub") != RHIShaderBytecodeCache::ComputeHash(lhs, "Stub2"), L"Compiler identity is hashed.");
+		context.Check(RHIShaderBytecodeCache::ComputeHash(lhs, "Stub") == RHIShaderBytecodeCache::ComputeHash(lhs, "Stub"), L"Hash is deterministic.");
+	}
+
+	TestRegistration GCompileAndMemoryHit(L"ShaderBytecodeCache.CompileAndMemoryHit", ETestKind::Test, CompileAndMemoryHit);
+	TestRegistration GDiskHit(L"ShaderBytecodeCache.DiskHit", ETestKind::Test, DiskHit);
+	TestRegistration GCompileFailure(L"ShaderBytecodeCache.CompileFailure", ETestKind::Test, CompileFailure);
+	TestRegistration GSourceHash(L"ShaderBytecodeCache.SourceHash", ETestKind::Test, SourceHash);
+}
\ No newline at end of file
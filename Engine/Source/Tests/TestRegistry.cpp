@@ -0,0 +1,97 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	struct TestCase
+	{
+		wstring_view Name;
+		ETestKind Kind;
+		TestRegistry::TestBody Body;
+	};
+
+	// Registered from static initializers of other translation units, so it should be constructed on first use.
+	vector<TestCase>& GetTestCases()
+	{
+		static vector<TestCase> testCases;
+		return testCases;
+	}
+}
+
+TestContext::TestContext(wstring_view name) : _name(name)
+{
+}
+
+bool TestContext::Check(bool bCondition, wstring_view message)
+{
+	++_numChecks;
+	if (!bCondition)
+	{
+		++_numFailures;
+		wcout << format(L"  FAILED: {}\n", message);
+	}
+	return bCondition;
+}
+
+void TestContext::Report(wstring_view metric, double value, wstring_view unit)
+{
+	wcout << format(L"  {}: {:.3f} {}\n", metric, value, unit);
+}
+
+void TestRegistry::Register(wstring_view name, ETestKind kind, TestBody body)
+{
+	GetTestCases().emplace_back(TestCase{ .Name = name, .Kind = kind, .Body = body });
+}
+
+size_t TestRegistry::Run(ETestKind kind, wstring_view filter)
+{
+	vector<TestCase> testCases = GetTestCases();
+	sort(testCases.begin(), testCases.end(), [](const TestCase& lhs, const TestCase& rhs)
+	{
+		return lhs.Name < rhs.Name;
+	});
+
+	size_t numRun = 0;
+	size_t numFailed = 0;
+	for (auto& testCase : testCases)
+	{
+		if (testCase.Kind != kind || (!filter.empty() && testCase.Name.find(filter) == wstring_view::npos))
+		{
+			continue;
+		}
+
+		wcout << format(L"[ RUN  ] {}\n", testCase.Name);
+		TestContext context(testCase.Name);
+		auto start = steady_clock::now();
+
+		bool bSucceeded = true;
+		try
+		{
+			testCase.Body(context);
+			bSucceeded = context.GetNumFailures() == 0;
+		}
+		catch (const exception& e)
+		{
+			wcout << format(L"  EXCEPTION: {}\n", StringUtils::AsUnicode(e.what()));
+			bSucceeded = false;
+		}
+
+		auto elapsed = duration_cast<duration<double, milli>>(steady_clock::now() - start);
+		wcout << format(L"[ {} ] {} ({} checks, {:.1f} ms)\n", bSucceeded ? L" OK " : L"FAIL", testCase.Name, context.GetNumChecks(), elapsed.count());
+
+		++numRun;
+		if (!bSucceeded)
+		{
+			++numFailed;
+		}
+	}
+
+	wcout << format(L"{} of {} test cases passed.\n", numRun - numFailed, numRun);
+	return numFailed;
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Tests:TestRegistry;
+
+import std.core;
+import SC.Runtime.Core;
+
+using namespace std;
+using namespace std::chrono;
+
+/// <summary>
+/// Represents kind of test case.
+/// </summary>
+export enum class ETestKind
+{
+	/// <summary>
+	/// Correctness test that runs by default.
+	/// </summary>
+	Test,
+
+	/// <summary>
+	/// Benchmark that runs only if requested, because it takes long time.
+	/// </summary>
+	Benchmark,
+};
+
+/// <summary>
+/// Represents execution context that passed to test body.
+/// </summary>
+export class TestContext
+{
+	wstring_view _name;
+	size_t _numChecks = 0;
+	size_t _numFailures = 0;
+
+public:
+	/// <summary>
+	/// Initialize new <see cref="TestContext"/> instance.
+	/// </summary>
+	/// <param name="name"> The name of running test. </param>
+	TestContext(wstring_view name);
+
+	/// <summary>
+	/// Check condition. Failure is reported and the test is continued.
+	/// </summary>
+	/// <param name="bCondition"> The condition that should be true. </param>
+	/// <param name="message"> The message that describes the condition. </param>
+	/// <returns> The condition. </returns>
+	bool Check(bool bCondition, wstring_view message);
+
+	/// <summary>
+	/// Report benchmark metric.
+	/// </summary>
+	/// <param name="metric"> The metric name. </param>
+	/// <param name="value"> The measured value. </param>
+	/// <param name="unit"> The unit of value. </param>
+	void Report(wstring_view metric, double value, wstring_view unit);
+
+	/// <summary>
+	/// Measure average duration of body per iteration after one warm-up run.
+	/// </summary>
+	/// <param name="iterations"> The count of measured iterations. </param>
+	/// <param name="body"> The measured body. </param>
+	/// <returns> The average duration of one iteration. </returns>
+	template<class TBody>
+	duration<double, micro> Measure(size_t iterations, TBody&& body)
+	{
+		body();
+		auto start = steady_clock::now();
+		for (size_t i = 0; i < iterations; ++i)
+		{
+			body();
+		}
+		return duration_cast<duration<double, micro>>(steady_clock::now() - start) / (double)max(iterations, (size_t)1);
+	}
+
+	/// <summary>
+	/// Get name of running test.
+	/// </summary>
+	wstring_view GetName() const { return _name; }
+
+	/// <summary>
+	/// Get count of checks.
+	/// </summary>
+	size_t GetNumChecks() const { return _numChecks; }
+
+	/// <summary>
+	/// Get count of failed checks.
+	/// </summary>
+	size_t GetNumFailures() const { return _numFailures; }
+};
+
+/// <summary>
+/// Represents registry of test cases. Test cases are registered at static initialization by <see cref="TestRegistration"/>.
+/// </summary>
+export class TestRegistry abstract final
+{
+public:
+	using TestBody = void(*)(TestContext&);
+
+	/// <summary>
+	/// Register test case.
+	/// </summary>
+	/// <param name="name"> The unique name of test case. Use 'Area.Case' form to filter easily. </param>
+	/// <param name="kind"> The kind of test case. </param>
+	/// <param name="body"> The test body. </param>
+	static void Register(wstring_view name, ETestKind kind, TestBody body);
+
+	/// <summary>
+	/// Run registered test cases.
+	/// </summary>
+	/// <param name="kind"> The kind of test cases to run. </param>
+	/// <param name="filter"> The test cases which name contains filter are run. Empty filter runs all. </param>
+	/// <returns> The count of failed test cases. </returns>
+	static size_t Run(ETestKind kind, wstring_view filter);
+};
+
+/// <summary>
+/// Register test case at static initialization.
+/// </summary>
+export struct TestRegistration
+{
+	TestRegistration(wstring_view name, ETestKind kind, TestRegistry::TestBody body)
+	{
+		TestRegistry::Register(name, kind, body);
+	}
+};
\ No newline at end of file
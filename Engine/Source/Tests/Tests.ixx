@@ -0,0 +1,6 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+export module SC.Tests;
+
+export import :TestRegistry;
+export import :AllocationCounter;
\ No newline at end of file
@@ -0,0 +1,226 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	class OrderTickFunction : public TickFunction
+	{
+	public:
+		using Super = TickFunction;
+
+		atomic<uint32>* Sequence = nullptr;
+		uint32 ExecutedOrder = 0;
+		uint32 NumExecuted = 0;
+		duration<float> LastElapsedTime = {};
+
+		OrderTickFunction(atomic<uint32>* sequence, bool bParallel = false) : Sequence(sequence)
+		{
+			bCanEverTick = true;
+			bAllowParallelTick = bParallel;
+		}
+
+		void ExecuteTick(duration<float> elapsedTime) override
+		{
+			ExecutedOrder = Sequence->fetch_add(1) + 1;
+			++NumExecuted;
+			LastElapsedTime = elapsedTime;
+		}
+	};
+
+	bool IsExecutedBefore(const OrderTickFunction& prerequisite, const OrderTickFunction& dependent)
+	{
+		return prerequisite.ExecutedOrder != 0 && prerequisite.ExecutedOrder < dependent.ExecutedOrder;
+	}
+
+	void TopologicalOrder(TestContext& context)
+	{
+		atomic<uint32> sequence = 0;
+		vector<unique_ptr<OrderTickFunction>> functions;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			functions.emplace_back(make_unique<OrderTickFunction>(&sequence));
+		}
+
+		// 3 -> 2 -> 1 -> 0, and 3 -> 0 directly. Registered in reverse order of dependency.
+		functions[0]->AddPrerequisiteFunction(functions[1].get());
+		functions[1]->AddPrerequisiteFunction(functions[2].get());
+		functions[2]->AddPrerequisiteFunction(functions[3].get());
+		functions[0]->AddPrerequisiteFunction(functions[3].get());
+
+		TickGraph graph;
+		for (auto& function : functions)
+		{
+			graph.Register(function.get());
+		}
+
+		graph.Execute(16ms);
+		context.Check(IsExecutedBefore(*functions[3], *functions[2]) && IsExecutedBefore(*functions[2], *functions[1]) && IsExecutedBefore(*functions[1], *functions[0]), L"Prerequisites are executed first.");
+
+		graph.Execute(16ms);
+		context.Check(graph.GetNumRebuilds() == 1, L"Graph is not rebuilt while unchanged.");
+
+		functions[3]->AddPrerequisiteFunction(functions[0].get());
+		functions[3]->RemovePrerequisiteFunction(functions[0].get());
+		graph.Execute(16ms);
+		context.Check(graph.GetNumRebuilds() == 2, L"Changing prerequisites rebuilds graph.");
+	}
+
+	void CrossGroupPrerequisite(TestContext& context)
+	{
+		atomic<uint32> sequence = 0;
+		OrderTickFunction late(&sequence);
+		OrderTickFunction early(&sequence);
+		OrderTickFunction other(&sequence);
+
+		late.TickGroup = ETickingGroup::PostPhysics;
+		early.TickGroup = ETickingGroup::PrePhysics;
+		other.TickGroup = ETickingGroup::DuringPhysics;
+		early.AddPrerequisiteFunction(&late);
+
+		TickGraph graph;
+		graph.Register(&early);
+		graph.Register(&late);
+		graph.Register(&other);
+		graph.Execute(16ms);
+
+		context.Check(early.GetActualTickGroup() == ETickingGroup::PostPhysics, L"Function is moved to group of its latest prerequisite.");
+		context.Check(IsExecutedBefore(late, early), L"Prerequisite in later group is executed first.");
+		context.Check(IsExecutedBefore(other, early), L"Moved function is executed after earlier groups.");
+	}
+
+	void CyclicPrerequisites(TestContext& context)
+	{
+		JobSystem::Initialize(3);
+
+		for (bool bParallel : { false, true })
+		{
+			atomic<uint32> sequence = 0;
+			OrderTickFunction first(&sequence, bParallel);
+			OrderTickFunction second(&sequence, bParallel);
+			OrderTickFunction self(&sequence, bParallel);
+			OrderTickFunction dependent(&sequence, bParallel);
+
+			first.AddPrerequisiteFunction(&second);
+			second.AddPrerequisiteFunction(&first);
+			self.AddPrerequisiteFunction(&self);
+			dependent.AddPrerequisiteFunction(&first);
+
+			TickGraph graph;
+			graph.Register(&first);
+			graph.Register(&second);
+			graph.Register(&self);
+			graph.Register(&dependent);
+			graph.Execute(16ms);
+
+			const wstring_view mode = bParallel ? L"parallel" : L"game thread";
+			context.Check(first.NumExecuted == 1 && second.NumExecuted == 1 && self.NumExecuted == 1, format(L"Functions in cycle are executed once, {}.", mode));
+			context.Check(IsExecutedBefore(first, dependent), format(L"Edge outside of cycle is kept, {}.", mode));
+		}
+
+		JobSystem::Shutdown();
+	}
+
+	void ParallelOrder(TestContext& context)
+	{
+		constexpr size_t NumChains = 64;
+		constexpr size_t ChainLength = 8;
+
+		JobSystem::Initialize(3);
+
+		atomic<uint32> sequence = 0;
+		vector<unique_ptr<OrderTickFunction>> functions;
+		TickGraph graph;
+		for (size_t i = 0; i < NumChains * ChainLength; ++i)
+		{
+			auto& function = functions.emplace_back(make_unique<OrderTickFunction>(&sequence, i % 3 != 0));
+			if (i % ChainLength != 0)
+			{
+				function->AddPrerequisiteFunction(functions[i - 1].get());
+			}
+			graph.Register(function.get());
+		}
+
+		bool bOrdered = true;
+		for (size_t frame = 0; frame < 10; ++frame)
+		{
+			graph.Execute(16ms);
+			for (size_t i = 0; i < functions.size(); ++i)
+			{
+				if (i % ChainLength != 0 && !IsExecutedBefore(*functions[i - 1], *functions[i]))
+				{
+					bOrdered = false;
+				}
+			}
+		}
+
+		JobSystem::Shutdown();
+
+		bool bAllExecuted = all_of(functions.begin(), functions.end(), [](auto& function) { return function->NumExecuted == 10; });
+		context.Check(bAllExecuted, L"All functions are executed once per frame.");
+		context.Check(bOrdered, L"Prerequisites are executed first with workers.");
+	}
+
+	void IntervalStagger(TestContext& context)
+	{
+		constexpr size_t NumFunctions = 60;
+		constexpr size_t NumFrames = 60;
+		constexpr duration<float> FrameTime = 10ms;
+
+		atomic<uint32> sequence = 0;
+		vector<unique_ptr<OrderTickFunction>> functions;
+		TickGraph graph;
+		for (size_t i = 0; i < NumFunctions; ++i)
+		{
+			auto& function = functions.emplace_back(make_unique<OrderTickFunction>(&sequence));
+			function->TickInterval = 100ms;
+			graph.Register(function.get());
+		}
+
+		OrderTickFunction everyFrame(&sequence);
+		graph.Register(&everyFrame);
+
+		uint32 maxPerFrame = 0;
+		bool bAccumulated = true;
+		for (size_t frame = 0; frame < NumFrames; ++frame)
+		{
+			graph.Execute(FrameTime);
+
+			uint32 numTicked = 0;
+			for (auto& function : functions)
+			{
+				if (function->IsExecutedOnThisFrame())
+				{
+					++numTicked;
+
+					// Elapsed time since previous tick, except first tick that is due at its phase.
+					// Rounding error of float may delay tick by one frame.
+					if (function->NumExecuted > 1 && abs(function->LastElapsedTime.count() - 0.1f) > 0.011f)
+					{
+						bAccumulated = false;
+					}
+				}
+			}
+			maxPerFrame = max(maxPerFrame, numTicked);
+		}
+
+		// 60 functions of 100ms interval on 10ms frames should be about 6 functions per frame, not 60 at once.
+		context.Check(maxPerFrame <= 12, format(L"Ticks of same interval are spread across frames. Max per frame: {}.", maxPerFrame));
+		context.Check(all_of(functions.begin(), functions.end(), [](auto& function) { return function->NumExecuted >= 5 && function->NumExecuted <= 7; }), L"Interval function ticks once per interval.");
+		context.Check(bAccumulated, L"Interval function receives elapsed time since its previous tick.");
+		context.Check(everyFrame.NumExecuted == NumFrames, L"Function without interval ticks every frame.");
+	}
+
+	TestRegistration GTopologicalOrder(L"TickGraph.TopologicalOrder", ETestKind::Test, TopologicalOrder);
+	TestRegistration GCrossGroupPrerequisite(L"TickGraph.CrossGroupPrerequisite", ETestKind::Test, CrossGroupPrerequisite);
+	TestRegistration GCyclicPrerequisites(L"TickGraph.CyclicPrerequisites", ETestKind::Test, CyclicPrerequisites);
+	TestRegistration GParallelOrder(L"TickGraph.ParallelOrder", ETestKind::Test, ParallelOrder);
+	TestRegistration GIntervalStagger(L"TickGraph.IntervalStagger", ETestKind::Test, IntervalStagger);
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	void DelayedCall(TestContext& context)
+	{
+		TickScheduler scheduler;
+		int32 numCalls = 0;
+		scheduler.AddSchedule(TickScheduleTaskInfo
+		{
+			.Task = [&numCalls]() { ++numCalls; },
+			.Delay = 500ms,
+			.InitDelay = 1s
+		});
+
+		scheduler.Tick(400ms);
+		context.Check(numCalls == 0, L"Task is not called before initial delay.");
+
+		scheduler.Tick(700ms);
+		context.Check(numCalls == 1, L"Task is called after initial delay.");
+
+		scheduler.Tick(300ms);
+		context.Check(numCalls == 1, L"Next call is scheduled with delay from current time.");
+
+		scheduler.Tick(300ms);
+		context.Check(numCalls == 2, L"Task is called after delay.");
+
+		scheduler.Tick(5s);
+		context.Check(numCalls == 3, L"Task without reliable call count is called once per tick.");
+	}
+
+	void ReliableCallCount(TestContext& context)
+	{
+		TickScheduler scheduler;
+		scheduler.SetMaxCatchUpCalls(3);
+
+		int32 numCalls = 0;
+		scheduler.AddSchedule(TickScheduleTaskInfo
+		{
+			.Task = [&numCalls]() { ++numCalls; },
+			.Delay = 100ms,
+			.InitDelay = 100ms,
+			.bReliableCallCount = true
+		});
+
+		scheduler.Tick(250ms);
+		context.Check(numCalls == 2, L"Missed calls are caught up in single tick.");
+
+		scheduler.Tick(10s);
+		context.Check(numCalls == 5, L"Catch-up calls are limited by maximum catch-up calls.");
+
+		scheduler.Tick(50ms);
+		context.Check(numCalls == 5, L"Dropped calls are not caught up later.");
+
+		scheduler.Tick(60ms);
+		context.Check(numCalls == 6, L"Next call is scheduled from time that calls are dropped.");
+	}
+
+	void ReliableCallCountWithoutDelay(TestContext& context)
+	{
+		TickScheduler scheduler;
+		int32 numCalls = 0;
+		scheduler.AddSchedule(TickScheduleTaskInfo
+		{
+			.Task = [&numCalls]() { ++numCalls; },
+			.bReliableCallCount = true
+		});
+
+		scheduler.Tick(16ms);
+		context.Check(numCalls == 1, L"Task without delay is called once per tick.");
+
+		scheduler.Tick(16ms);
+		scheduler.Tick(16ms);
+		context.Check(numCalls == 3, L"Task without delay is not caught up.");
+	}
+
+	void ModifyWhileTicking(TestContext& context)
+	{
+		TickScheduler scheduler;
+		int32 numSelfRemoved = 0;
+		int32 numAdded = 0;
+		int64 selfId = -1;
+
+		selfId = scheduler.AddSchedule(TickScheduleTaskInfo
+		{
+			.Task = [&]()
+			{
+				++numSelfRemoved;
+				scheduler.RemoveSchedule(selfId);
+				scheduler.AddSchedule(TickScheduleTaskInfo{ .Task = [&numAdded]() { ++numAdded; } });
+			}
+		});
+
+		scheduler.Tick(16ms);
+		context.Check(numSelfRemoved == 1, L"Task can remove itself.");
+		context.Check(numAdded == 0, L"Schedule added while ticking is not called in same tick.");
+		context.Check(scheduler.GetNumSchedules() == 1, L"Added schedule is registered.");
+
+		scheduler.Tick(16ms);
+		context.Check(numSelfRemoved == 1, L"Removed task is not called again.");
+		context.Check(numAdded == 1, L"Added schedule is called from next tick.");
+	}
+
+	void ThrowingTask(TestContext& context)
+	{
+		TickScheduler scheduler;
+		int32 numCalls = 0;
+		int32 numThrowingCalls = 0;
+		bool bThrow = true;
+		scheduler.AddSchedule(TickScheduleTaskInfo
+		{
+			.Task = [&]()
+			{
+				++numThrowingCalls;
+				if (bThrow)
+				{
+					bThrow = false;
+					scheduler.AddSchedule(TickScheduleTaskInfo{ .Task = [&numCalls]() { ++numCalls; } });
+					throw runtime_error("Task failed.");
+				}
+			}
+		});
+
+		bool bThrown = false;
+		try
+		{
+			scheduler.Tick(16ms);
+		}
+		catch (const runtime_error&)
+		{
+			bThrown = true;
+		}
+
+		scheduler.Tick(16ms);
+		context.Check(bThrown, L"Exception of task is propagated.");
+		context.Check(numCalls == 1, L"Schedule added before exception is called from next tick.");
+		context.Check(numThrowingCalls == 2, L"Task that threw is rescheduled.");
+
+		scheduler.Tick(16ms);
+		context.Check(numThrowingCalls == 3, L"Task that threw keeps firing.");
+	}
+
+	void ManySchedules(TestContext& context)
+	{
+		constexpr size_t NumSchedules = 100000;
+		constexpr size_t NumFrames = 600;
+
+		TickScheduler scheduler;
+		mt19937 random(0);
+		uniform_real_distribution<float> delays(0.1f, 10.0f);
+
+		size_t numCalls = 0;
+		for (size_t i = 0; i < NumSchedules; ++i)
+		{
+			float delay = delays(random);
+			scheduler.AddSchedule(TickScheduleTaskInfo
+			{
+				.Task = [&numCalls]() { ++numCalls; },
+				.Delay = duration<float>(delay),
+				.InitDelay = duration<float>(delay)
+			});
+		}
+
+		auto frame = context.Measure(NumFrames, [&]() { scheduler.Tick(16ms); });
+		context.Report(L"TickScheduler::Tick, 100k schedules", frame.count(), L"us/frame");
+		context.Report(L"Calls", (double)numCalls / (NumFrames + 1), L"calls/frame");
+	}
+
+	TestRegistration GDelayedCall(L"TickScheduler.DelayedCall", ETestKind::Test, DelayedCall);
+	TestRegistration GReliableCallCount(L"TickScheduler.ReliableCallCount", ETestKind::Test, ReliableCallCount);
+	TestRegistration GReliableCallCountWithoutDelay(L"TickScheduler.ReliableCallCountWithoutDelay", ETestKind::Test, ReliableCallCountWithoutDelay);
+	TestRegistration GModifyWhileTicking(L"TickScheduler.ModifyWhileTicking", ETestKind::Test, ModifyWhileTicking);
+	TestRegistration GThrowingTask(L"TickScheduler.ThrowingTask", ETestKind::Test, ThrowingTask);
+	TestRegistration GManySchedules(L"TickScheduler.ManySchedules", ETestKind::Benchmark, ManySchedules);
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import std.threading;
+import SC.Runtime.Core;
+import SC.Runtime.Game;
+import SC.Tests;
+
+using namespace std;
+using namespace std::chrono;
+
+namespace
+{
+	// Actors do not begin play in this test world, so per-actor work is placed on tick function owned by actor.
+	class WorkTickFunction : public TickFunction
+	{
+	public:
+		using Super = TickFunction;
+
+		thread::id LastThread;
+		float State = 1.0f;
+		int32 WorkAmount = 0;
+
+		void ExecuteTick(duration<float> elapsedTime) override
+		{
+			LastThread = this_thread::get_id();
+			for (int32 i = 0; i < WorkAmount; ++i)
+			{
+				State = sqrt(State * 1.0001f + elapsedTime.count());
+			}
+		}
+	};
+
+	class TickTestActor : public AActor
+	{
+	public:
+		using Super = AActor;
+
+		WorkTickFunction WorkTick;
+
+		TickTestActor()
+		{
+			PrimaryActorTick.bCanEverTick = true;
+			WorkTick.bCanEverTick = true;
+		}
+
+		ActorTickFunction* GetPrimaryActorTick()
+		{
+			return &PrimaryActorTick;
+		}
+	};
+
+	vector<TickTestActor*> SpawnTickActors(World& world, size_t count, int32 workAmount, size_t parallelRatio)
+	{
+		vector<TickTestActor*> actors;
+		actors.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			auto* actor = world.SpawnActor<TickTestActor>();
+			actor->WorkTick.WorkAmount = workAmount;
+			actor->WorkTick.bAllowParallelTick = parallelRatio != 0 && i % parallelRatio != 0;
+			actor->WorkTick.AddPrerequisiteFunction(actor->GetPrimaryActorTick());
+
+			// Chain some actors, so graph has dependencies across actors.
+			if (i % 10 == 9)
+			{
+				actor->WorkTick.AddPrerequisiteFunction(&actors[i - 1]->WorkTick);
+			}
+
+			world.RegisterTickFunction(&actor->WorkTick);
+			actors.emplace_back(actor);
+		}
+		return actors;
+	}
+
+	void GameThreadByDefault(TestContext& context)
+	{
+		JobSystem::Initialize(3);
+		{
+			World world;
+			vector<TickTestActor*> actors = SpawnTickActors(world, 256, 1, 0);
+			world.LevelTick(16ms);
+
+			const thread::id gameThread = this_thread::get_id();
+			bool bAllOnGameThread = all_of(actors.begin(), actors.end(), [gameThread](TickTestActor* actor)
+			{
+				return actor->WorkTick.IsExecutedOnThisFrame() && actor->WorkTick.LastThread == gameThread;
+			});
+			context.Check(bAllOnGameThread, L"Tick functions that do not allow parallel tick are executed on game thread.");
+
+			for (auto& actor : actors)
+			{
+				actor->WorkTick.bAllowParallelTick = true;
+			}
+
+			world.LevelTick(16ms);
+			bool bAllExecuted = all_of(actors.begin(), actors.end(), [](TickTestActor* actor) { return actor->WorkTick.IsExecutedOnThisFrame(); });
+			context.Check(bAllExecuted, L"Parallel tick functions are all executed in frame.");
+		}
+		JobSystem::Shutdown();
+	}
+
+	void TenThousandActors(TestContext& context)
+	{
+		constexpr size_t NumActors = 10000;
+		constexpr size_t NumFrames = 60;
+
+		const size_t maxThreads = max(thread::hardware_concurrency(), 1u);
+
+		for (auto [workAmount, workName] : { pair(0, L"empty"), pair(64, L"64 ops") })
+		{
+			for (size_t numThreads : { (size_t)1, maxThreads })
+			{
+				if (numThreads > 1)
+				{
+					JobSystem::Initialize(numThreads - 1);
+				}
+
+				for (auto [parallelRatio, ratioName] : { pair((size_t)0, L"game thread"), pair((size_t)4, L"75% parallel") })
+				{
+					World world;
+					SpawnTickActors(world, NumActors, workAmount, parallelRatio);
+
+					auto frame = context.Measure(NumFrames, [&]() { world.LevelTick(16ms); });
+					context.Report(format(L"{} threads, {}, {}", numThreads, workName, ratioName), frame.count() / 1000.0, L"ms/frame");
+				}
+
+				JobSystem::Shutdown();
+			}
+		}
+	}
+
+	TestRegistration GGameThreadByDefault(L"WorldTick.GameThreadByDefault", ETestKind::Test, GameThreadByDefault);
+	TestRegistration GTenThousandActors(L"WorldTick.TenThousandActors", ETestKind::Benchmark, TenThousandActors);
+}
\ No newline at end of file
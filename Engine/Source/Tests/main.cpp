@@ -0,0 +1,30 @@
+// Copyright 2020-2021 Aumoa.lib. All right reserved.
+
+import std.core;
+import SC.Runtime.Core;
+import SC.Tests;
+
+using namespace std;
+
+/// Usage: Tests.exe [--benchmark] [filter]
+/// Correctness tests run by default. Benchmarks run only with --benchmark.
+int wmain(int argc, wchar_t* argv[])
+{
+	ETestKind kind = ETestKind::Test;
+	wstring_view filter;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		wstring_view arg = argv[i];
+		if (arg == L"--benchmark")
+		{
+			kind = ETestKind::Benchmark;
+		}
+		else
+		{
+			filter = arg;
+		}
+	}
+
+	return TestRegistry::Run(kind, filter) == 0 ? 0 : 1;
+}
\ No newline at end of file
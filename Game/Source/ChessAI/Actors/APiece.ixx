@@ -3,6 +3,7 @@
 export module SC.Game.ChessAI:APiece;
 
 import std.core;
+import SC.Runtime.Core;
 import SC.Runtime.Game;
 import :AChessBoard;
 
@@ -14,11 +15,17 @@ public:
 	using Super = AActor;
 
 private:
-	AChessBoard* _board = nullptr;
+	ObjectHandle _board;
 
 public:
 	APiece(AChessBoard* board) : Super()
-		, _board(board)
+		, _board(board->GetHandle())
 	{
 	}
+
+	AChessBoard* GetBoard() const
+	{
+		World* const world = GetWorld();
+		return world != nullptr ? world->ResolveActor<AChessBoard>(_board) : nullptr;
+	}
 };
\ No newline at end of file